@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CCostModelCalibrator.h
+//
+//	@doc:
+//		Fitting of GPDB cost model parameters to executed plans
+//---------------------------------------------------------------------------
+#ifndef GPDBCOST_CCostModelCalibrator_H
+#define GPDBCOST_CCostModelCalibrator_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/string/CStringDynamic.h"
+
+#include "gpdbcost/CCostModelParamsGPDB.h"
+
+// default number of nodes needed before the parameters of a group are fitted
+#define GPDBCOST_CALIBRATION_MIN_SAMPLES 5
+
+namespace gpdxl
+{
+class CDXLNode;
+class CXMLSerializer;
+}
+
+namespace gpopt
+{
+using namespace gpos;
+using gpdxl::CDXLNode;
+using gpdxl::CXMLSerializer;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CCostModelCalibrator
+//
+//	@doc:
+//		Fits the unit costs of the GPDB cost model to executed plans.
+//
+//		Each plan is a DXL plan, as produced by the optimizer, along with a
+//		timing file holding the actual rows and the actual time, in ms, of
+//		each physical plan node. The file has one "rows,time" line per node,
+//		in the depth-first order of the nodes in the plan; scalar
+//		subplans are not included, and lines starting with '#' are ignored.
+//
+//		The self cost and self time of a node are its cost and time minus
+//		those of its physical children. The estimated self cost is scaled by
+//		the ratio of actual to estimated rows flowing through the node, so
+//		that cardinality errors are not mistaken for wrong unit costs.
+//
+//		Calibrated parameters are fitted by least squares in two steps:
+//		a global ratio of time to cost over all nodes, then the same ratio
+//		over the nodes of each operator group. The parameters of a group
+//		are multiplied by the ratio of the two, so that operators that run
+//		slower than their cost suggests become more expensive relative to
+//		the others. Groups with too few nodes keep their parameters.
+//
+//---------------------------------------------------------------------------
+class CCostModelCalibrator
+{
+public:
+	// groups of operators whose parameters are fitted together
+	enum ECalibrationGroup
+	{
+		EcgTableScan = 0,
+		EcgIndexScan,
+		EcgBitmapScan,
+		EcgHashJoin,
+		EcgNLJoin,
+		EcgGatherMotion,
+		EcgRedistributeMotion,
+		EcgBroadcastMotion,
+		EcgHashAgg,
+		EcgSort,
+		EcgMaterialize,
+
+		EcgSentinel
+	};
+
+private:
+	// sums of the least squares fit of a group
+	struct SFit
+	{
+		// number of nodes
+		ULONG m_ulSamples;
+
+		// sum of the products of self time and self cost
+		DOUBLE m_dTimeCost;
+
+		// sum of the squares of self cost
+		DOUBLE m_dCostCost;
+	};
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of nodes needed before the parameters of a group are fitted
+	ULONG m_ulMinSamples;
+
+	// fit of each group
+	SFit m_rgfit[EcgSentinel];
+
+	// fit over all nodes
+	SFit m_fitAll;
+
+	// private copy ctor
+	CCostModelCalibrator(const CCostModelCalibrator &);
+
+	// group of the given node, or EcgSentinel if no parameters are fitted
+	static ECalibrationGroup Ecg(const CDXLNode *dxlnode);
+
+	// estimated rows and total cost of a physical node
+	void Estimates(const CDXLNode *dxlnode, DOUBLE *pdRows,
+				   DOUBLE *pdCost) const;
+
+	// number of physical nodes in the given plan
+	static ULONG UlNodes(const CDXLNode *dxlnode);
+
+	// add the nodes of a plan to the fit, starting with the node at the
+	// given depth-first position; return the position after the subtree
+	ULONG UlAddNode(const CDXLNode *dxlnode, const DOUBLE *rgdRows,
+					const DOUBLE *rgdTime, ULONG ulPos);
+
+	// parse a timing file; return the number of nodes, or gpos::ulong_max
+	// if the file is malformed
+	static ULONG UlParseTiming(CHAR *szTiming, DOUBLE *rgdRows,
+							   DOUBLE *rgdTime, ULONG ulMaxNodes);
+
+	// add a sample to a fit
+	static void
+	AddSample(SFit *pfit, DOUBLE dTime, DOUBLE dCost)
+	{
+		pfit->m_ulSamples++;
+		pfit->m_dTimeCost += dTime * dCost;
+		pfit->m_dCostCost += dCost * dCost;
+	}
+
+	// add a double-valued attribute with full precision
+	static void AddDoubleAttribute(CMemoryPool *mp,
+								   CXMLSerializer *xml_serializer,
+								   const CWStringConst *pstrAttr,
+								   CDouble dValue);
+
+public:
+	// ctor
+	CCostModelCalibrator(CMemoryPool *mp,
+						 ULONG ulMinSamples = GPDBCOST_CALIBRATION_MIN_SAMPLES);
+
+	// add an executed plan given as DXL, with the actual rows and time of
+	// each physical node in depth-first order; return false if the number
+	// of nodes does not match
+	BOOL FAddPlan(const CDXLNode *pdxlnPlan, const DOUBLE *rgdRows,
+				  const DOUBLE *rgdTime, ULONG ulNodes);
+
+	// add an executed plan from a DXL plan file and its timing file;
+	// return false if the files do not match
+	BOOL FAddPlan(const CHAR *szPlanFileName, const CHAR *szTimingFileName);
+
+	// number of nodes added to the given group
+	ULONG
+	UlSamples(ECalibrationGroup ecg) const
+	{
+		GPOS_ASSERT(EcgSentinel > ecg);
+
+		return m_rgfit[ecg].m_ulSamples;
+	}
+
+	// factor the parameters of a group are multiplied by; one if the
+	// group has too few nodes
+	CDouble DMultiplier(ECalibrationGroup ecg) const;
+
+	// calibrate the given parameters in place
+	void Calibrate(CCostModelParamsGPDB *pcp) const;
+
+	// serialize the given parameters as a DXL document with a top-level
+	// CostParams element
+	static void SerializeParams(CMemoryPool *mp, CCostModelParamsGPDB *pcp,
+								CStringDynamic *pstr);
+
+	// name of the given group
+	static const CHAR *SzGroup(ECalibrationGroup ecg);
+
+};	// class CCostModelCalibrator
+
+}  // namespace gpopt
+
+#endif	// !GPDBCOST_CCostModelCalibrator_H
+
+// EOF
@@ -187,6 +187,12 @@ private:
 							  const CCostModelGPDB *pcmgpdb,
 							  const SCostingInfo *pci);
 
+	// cost of a hash join that emits the unmatched tuples of its inner child
+	static CCost CostHashJoinPreservingInner(CMemoryPool *mp,
+											 CExpressionHandle &exprhdl,
+											 const CCostModelGPDB *pcmgpdb,
+											 const SCostingInfo *pci);
+
 	// cost of merge join
 	static CCost CostMergeJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 							   const CCostModelGPDB *pcmgpdb,
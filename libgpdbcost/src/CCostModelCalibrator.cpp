@@ -0,0 +1,615 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CCostModelCalibrator.cpp
+//
+//	@doc:
+//		Fitting of GPDB cost model parameters to executed plans
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/io/COstreamUTF8.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/dxl/operators/CDXLPhysicalAgg.h"
+#include "naucrates/dxl/operators/CDXLPhysicalProperties.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/dxl/xml/dxltokens.h"
+
+#include "gpdbcost/CCostModelCalibrator.h"
+
+using namespace gpopt;
+using namespace gpdxl;
+
+// parameters of each calibration group; other parameters, such as those
+// shared by several groups, are left as they are
+static const CCostModelParamsGPDB::ECostParam rgecpTableScan[] = {
+	CCostModelParamsGPDB::EcpTableScanCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpIndexScan[] = {
+	CCostModelParamsGPDB::EcpIndexBlockCostUnit,
+	CCostModelParamsGPDB::EcpIndexFilterCostUnit,
+	CCostModelParamsGPDB::EcpIndexScanTupCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpBitmapScan[] = {
+	CCostModelParamsGPDB::EcpBitmapIOCostLargeNDV,
+	CCostModelParamsGPDB::EcpBitmapIOCostSmallNDV,
+	CCostModelParamsGPDB::EcpBitmapPageCostLargeNDV,
+	CCostModelParamsGPDB::EcpBitmapPageCostSmallNDV,
+	CCostModelParamsGPDB::EcpBitmapPageCost};
+
+static const CCostModelParamsGPDB::ECostParam rgecpHashJoin[] = {
+	CCostModelParamsGPDB::EcpHJHashTableColumnCostUnit,
+	CCostModelParamsGPDB::EcpHJHashTableWidthCostUnit,
+	CCostModelParamsGPDB::EcpHJHashingTupWidthCostUnit,
+	CCostModelParamsGPDB::EcpHJFeedingTupColumnSpillingCostUnit,
+	CCostModelParamsGPDB::EcpHJFeedingTupWidthSpillingCostUnit,
+	CCostModelParamsGPDB::EcpHJHashingTupWidthSpillingCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpNLJoin[] = {
+	CCostModelParamsGPDB::EcpNLJFactor};
+
+static const CCostModelParamsGPDB::ECostParam rgecpGatherMotion[] = {
+	CCostModelParamsGPDB::EcpGatherSendCostUnit,
+	CCostModelParamsGPDB::EcpGatherRecvCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpRedistributeMotion[] = {
+	CCostModelParamsGPDB::EcpRedistributeSendCostUnit,
+	CCostModelParamsGPDB::EcpRedistributeRecvCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpBroadcastMotion[] = {
+	CCostModelParamsGPDB::EcpBroadcastSendCostUnit,
+	CCostModelParamsGPDB::EcpBroadcastRecvCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpHashAgg[] = {
+	CCostModelParamsGPDB::EcpHashAggInputTupColumnCostUnit,
+	CCostModelParamsGPDB::EcpHashAggInputTupWidthCostUnit,
+	CCostModelParamsGPDB::EcpHashAggOutputTupWidthCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpSort[] = {
+	CCostModelParamsGPDB::EcpSortTupWidthCostUnit};
+
+static const CCostModelParamsGPDB::ECostParam rgecpMaterialize[] = {
+	CCostModelParamsGPDB::EcpMaterializeCostUnit};
+
+// mapping of calibration groups to their names and parameters
+struct SCalibrationGroupMapping
+{
+	CCostModelCalibrator::ECalibrationGroup m_ecg;
+	const CHAR *m_szName;
+	const CCostModelParamsGPDB::ECostParam *m_rgecp;
+	ULONG m_ulParams;
+};
+
+static const SCalibrationGroupMapping rgcgm[] = {
+	{CCostModelCalibrator::EcgTableScan, "TableScan", rgecpTableScan,
+	 GPOS_ARRAY_SIZE(rgecpTableScan)},
+	{CCostModelCalibrator::EcgIndexScan, "IndexScan", rgecpIndexScan,
+	 GPOS_ARRAY_SIZE(rgecpIndexScan)},
+	{CCostModelCalibrator::EcgBitmapScan, "BitmapScan", rgecpBitmapScan,
+	 GPOS_ARRAY_SIZE(rgecpBitmapScan)},
+	{CCostModelCalibrator::EcgHashJoin, "HashJoin", rgecpHashJoin,
+	 GPOS_ARRAY_SIZE(rgecpHashJoin)},
+	{CCostModelCalibrator::EcgNLJoin, "NLJoin", rgecpNLJoin,
+	 GPOS_ARRAY_SIZE(rgecpNLJoin)},
+	{CCostModelCalibrator::EcgGatherMotion, "GatherMotion", rgecpGatherMotion,
+	 GPOS_ARRAY_SIZE(rgecpGatherMotion)},
+	{CCostModelCalibrator::EcgRedistributeMotion, "RedistributeMotion",
+	 rgecpRedistributeMotion, GPOS_ARRAY_SIZE(rgecpRedistributeMotion)},
+	{CCostModelCalibrator::EcgBroadcastMotion, "BroadcastMotion",
+	 rgecpBroadcastMotion, GPOS_ARRAY_SIZE(rgecpBroadcastMotion)},
+	{CCostModelCalibrator::EcgHashAgg, "HashAgg", rgecpHashAgg,
+	 GPOS_ARRAY_SIZE(rgecpHashAgg)},
+	{CCostModelCalibrator::EcgSort, "Sort", rgecpSort,
+	 GPOS_ARRAY_SIZE(rgecpSort)},
+	{CCostModelCalibrator::EcgMaterialize, "Materialize", rgecpMaterialize,
+	 GPOS_ARRAY_SIZE(rgecpMaterialize)},
+};
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::CCostModelCalibrator
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CCostModelCalibrator::CCostModelCalibrator(CMemoryPool *mp, ULONG ulMinSamples)
+	: m_mp(mp), m_ulMinSamples(ulMinSamples)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(0 < ulMinSamples);
+	GPOS_ASSERT(EcgSentinel == GPOS_ARRAY_SIZE(rgcgm));
+
+	SFit fitEmpty = {0, 0.0, 0.0};
+	for (ULONG ul = 0; ul < EcgSentinel; ul++)
+	{
+		GPOS_ASSERT(ul == (ULONG) rgcgm[ul].m_ecg);
+		m_rgfit[ul] = fitEmpty;
+	}
+	m_fitAll = fitEmpty;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::Ecg
+//
+//	@doc:
+//		Group of the given physical node
+//
+//---------------------------------------------------------------------------
+CCostModelCalibrator::ECalibrationGroup
+CCostModelCalibrator::Ecg(const CDXLNode *dxlnode)
+{
+	switch (dxlnode->GetOperator()->GetDXLOperator())
+	{
+		case EdxlopPhysicalTableScan:
+		case EdxlopPhysicalDynamicTableScan:
+		case EdxlopPhysicalExternalScan:
+			return EcgTableScan;
+
+		case EdxlopPhysicalIndexScan:
+		case EdxlopPhysicalIndexOnlyScan:
+		case EdxlopPhysicalDynamicIndexScan:
+			return EcgIndexScan;
+
+		case EdxlopPhysicalBitmapTableScan:
+		case EdxlopPhysicalDynamicBitmapTableScan:
+			return EcgBitmapScan;
+
+		case EdxlopPhysicalHashJoin:
+			return EcgHashJoin;
+
+		case EdxlopPhysicalNLJoin:
+			return EcgNLJoin;
+
+		case EdxlopPhysicalMotionGather:
+			return EcgGatherMotion;
+
+		case EdxlopPhysicalMotionRedistribute:
+		case EdxlopPhysicalMotionRoutedDistribute:
+		case EdxlopPhysicalMotionRandom:
+			return EcgRedistributeMotion;
+
+		case EdxlopPhysicalMotionBroadcast:
+			return EcgBroadcastMotion;
+
+		case EdxlopPhysicalAgg:
+			if (EdxlaggstrategyHashed ==
+				CDXLPhysicalAgg::Cast(dxlnode->GetOperator())->GetAggStrategy())
+			{
+				return EcgHashAgg;
+			}
+			return EcgSentinel;
+
+		case EdxlopPhysicalSort:
+			return EcgSort;
+
+		case EdxlopPhysicalMaterialize:
+			return EcgMaterialize;
+
+		default:
+			return EcgSentinel;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::Estimates
+//
+//	@doc:
+//		Estimated rows and total cost of a physical node
+//
+//---------------------------------------------------------------------------
+void
+CCostModelCalibrator::Estimates(const CDXLNode *dxlnode, DOUBLE *pdRows,
+								DOUBLE *pdCost) const
+{
+	CDXLOperatorCost *pdxlopcost =
+		CDXLPhysicalProperties::PdxlpropConvert(dxlnode->GetProperties())
+			->GetDXLOperatorCost();
+
+	CStringDynamic strRows(m_mp);
+	strRows.AppendWideCharArray(pdxlopcost->GetRowsOutStr()->GetBuffer());
+	CStringDynamic strCost(m_mp);
+	strCost.AppendWideCharArray(pdxlopcost->GetTotalCostStr()->GetBuffer());
+
+	*pdRows = clib::Strtod(strRows.GetBuffer());
+	*pdCost = clib::Strtod(strCost.GetBuffer());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::UlNodes
+//
+//	@doc:
+//		Number of physical nodes in the given plan, not counting those in
+//		scalar subplans
+//
+//---------------------------------------------------------------------------
+ULONG
+CCostModelCalibrator::UlNodes(const CDXLNode *dxlnode)
+{
+	ULONG ulNodes = 1;
+	const ULONG arity = dxlnode->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CDXLNode *pdxlnChild = (*dxlnode)[ul];
+		if (EdxloptypePhysical ==
+			pdxlnChild->GetOperator()->GetDXLOperatorType())
+		{
+			ulNodes += UlNodes(pdxlnChild);
+		}
+	}
+
+	return ulNodes;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::UlAddNode
+//
+//	@doc:
+//		Add the self cost and self time of the node at the given position,
+//		and of its physical descendants, to the fit
+//
+//---------------------------------------------------------------------------
+ULONG
+CCostModelCalibrator::UlAddNode(const CDXLNode *dxlnode,
+								const DOUBLE *rgdRows, const DOUBLE *rgdTime,
+								ULONG ulPos)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	const ULONG ulNodePos = ulPos;
+	DOUBLE dEstRows = 0.0;
+	DOUBLE dCost = 0.0;
+	Estimates(dxlnode, &dEstRows, &dCost);
+
+	// rows flowing through the node, both estimated and actual
+	DOUBLE dEstRowsProcessed = dEstRows;
+	DOUBLE dRowsProcessed = rgdRows[ulNodePos];
+	DOUBLE dTime = rgdTime[ulNodePos];
+
+	ulPos++;
+	const ULONG arity = dxlnode->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CDXLNode *pdxlnChild = (*dxlnode)[ul];
+		if (EdxloptypePhysical !=
+			pdxlnChild->GetOperator()->GetDXLOperatorType())
+		{
+			continue;
+		}
+
+		DOUBLE dChildEstRows = 0.0;
+		DOUBLE dChildCost = 0.0;
+		Estimates(pdxlnChild, &dChildEstRows, &dChildCost);
+
+		dCost -= dChildCost;
+		dTime -= rgdTime[ulPos];
+		dEstRowsProcessed += dChildEstRows;
+		dRowsProcessed += rgdRows[ulPos];
+
+		ulPos = UlAddNode(pdxlnChild, rgdRows, rgdTime, ulPos);
+	}
+
+	// nodes whose cost or time are not positive, such as those the
+	// executor did not run, carry no information
+	if (0.0 >= dCost || 0.0 >= dTime)
+	{
+		return ulPos;
+	}
+
+	if (0.0 < dEstRowsProcessed)
+	{
+		dCost = dCost * dRowsProcessed / dEstRowsProcessed;
+	}
+
+	AddSample(&m_fitAll, dTime, dCost);
+
+	ECalibrationGroup ecg = Ecg(dxlnode);
+	if (EcgSentinel != ecg)
+	{
+		AddSample(&m_rgfit[ecg], dTime, dCost);
+	}
+
+	return ulPos;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::FAddPlan
+//
+//	@doc:
+//		Add an executed plan given as DXL
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelCalibrator::FAddPlan(const CDXLNode *pdxlnPlan,
+							   const DOUBLE *rgdRows, const DOUBLE *rgdTime,
+							   ULONG ulNodes)
+{
+	GPOS_ASSERT(NULL != pdxlnPlan);
+	GPOS_ASSERT(NULL != rgdRows);
+	GPOS_ASSERT(NULL != rgdTime);
+
+	if (UlNodes(pdxlnPlan) != ulNodes)
+	{
+		return false;
+	}
+
+#ifdef GPOS_DEBUG
+	ULONG ulPos =
+#endif	// GPOS_DEBUG
+		UlAddNode(pdxlnPlan, rgdRows, rgdTime, 0 /*ulPos*/);
+	GPOS_ASSERT(ulPos == ulNodes);
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::UlParseTiming
+//
+//	@doc:
+//		Parse the "rows,time" lines of a timing file
+//
+//---------------------------------------------------------------------------
+ULONG
+CCostModelCalibrator::UlParseTiming(CHAR *szTiming, DOUBLE *rgdRows,
+									DOUBLE *rgdTime, ULONG ulMaxNodes)
+{
+	ULONG ulNodes = 0;
+	CHAR *szLine = szTiming;
+	while (CHAR_EOS != *szLine)
+	{
+		CHAR *szNextLine = clib::Strchr(szLine, '\n');
+		if (NULL != szNextLine)
+		{
+			*szNextLine = CHAR_EOS;
+			szNextLine++;
+		}
+		else
+		{
+			szNextLine = szLine + clib::Strlen(szLine);
+		}
+
+		CHAR *szTime = clib::Strchr(szLine, ',');
+		if ('#' != *szLine && NULL != szTime)
+		{
+			if (ulNodes == ulMaxNodes)
+			{
+				return gpos::ulong_max;
+			}
+
+			*szTime = CHAR_EOS;
+			rgdRows[ulNodes] = clib::Strtod(szLine);
+			rgdTime[ulNodes] = clib::Strtod(szTime + 1);
+			ulNodes++;
+		}
+
+		szLine = szNextLine;
+	}
+
+	return ulNodes;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::FAddPlan
+//
+//	@doc:
+//		Add an executed plan from a DXL plan file and its timing file
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelCalibrator::FAddPlan(const CHAR *szPlanFileName,
+							   const CHAR *szTimingFileName)
+{
+	GPOS_ASSERT(NULL != szPlanFileName);
+	GPOS_ASSERT(NULL != szTimingFileName);
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> a_szPlan;
+	a_szPlan = CDXLUtils::Read(mp, szPlanFileName);
+
+	ULLONG plan_id = 0;
+	ULLONG plan_space_size = 0;
+	CAutoRef<CDXLNode> a_pdxlnPlan;
+	a_pdxlnPlan = CDXLUtils::GetPlanDXLNode(mp, a_szPlan.Rgt(),
+											NULL /*xsd_file_path*/, &plan_id,
+											&plan_space_size);
+
+	const ULONG ulNodes = UlNodes(a_pdxlnPlan.Value());
+	CAutoRg<DOUBLE> a_rgdRows;
+	a_rgdRows = GPOS_NEW_ARRAY(mp, DOUBLE, ulNodes);
+	CAutoRg<DOUBLE> a_rgdTime;
+	a_rgdTime = GPOS_NEW_ARRAY(mp, DOUBLE, ulNodes);
+
+	CAutoRg<CHAR> a_szTiming;
+	a_szTiming = CDXLUtils::Read(mp, szTimingFileName);
+	ULONG ulTimedNodes = UlParseTiming(a_szTiming.Rgt(), a_rgdRows.Rgt(),
+									   a_rgdTime.Rgt(), ulNodes);
+
+	return ulTimedNodes == ulNodes &&
+		   FAddPlan(a_pdxlnPlan.Value(), a_rgdRows.Rgt(), a_rgdTime.Rgt(),
+					ulNodes);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::DMultiplier
+//
+//	@doc:
+//		Ratio of the time per cost unit of a group to the time per cost
+//		unit over all nodes, both fitted by least squares through the origin
+//
+//---------------------------------------------------------------------------
+CDouble
+CCostModelCalibrator::DMultiplier(ECalibrationGroup ecg) const
+{
+	GPOS_ASSERT(EcgSentinel > ecg);
+
+	const SFit &fit = m_rgfit[ecg];
+	if (m_ulMinSamples > fit.m_ulSamples || 0.0 == m_fitAll.m_dTimeCost)
+	{
+		return CDouble(1.0);
+	}
+
+	DOUBLE dRatioAll = m_fitAll.m_dTimeCost / m_fitAll.m_dCostCost;
+	DOUBLE dRatio = fit.m_dTimeCost / fit.m_dCostCost;
+
+	return CDouble(dRatio / dRatioAll);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::Calibrate
+//
+//	@doc:
+//		Multiply the parameters of each group, along with their bounds, by
+//		the multiplier of the group
+//
+//---------------------------------------------------------------------------
+void
+CCostModelCalibrator::Calibrate(CCostModelParamsGPDB *pcp) const
+{
+	GPOS_ASSERT(NULL != pcp);
+
+	for (ULONG ul = 0; ul < EcgSentinel; ul++)
+	{
+		CDouble dMultiplier = DMultiplier(rgcgm[ul].m_ecg);
+		for (ULONG ulParam = 0; ulParam < rgcgm[ul].m_ulParams; ulParam++)
+		{
+			ULONG id = rgcgm[ul].m_rgecp[ulParam];
+			ICostModelParams::SCostParam *pcpParam = pcp->PcpLookup(id);
+			pcp->SetParam(id, pcpParam->Get() * dMultiplier,
+						  pcpParam->GetLowerBoundVal() * dMultiplier,
+						  pcpParam->GetUpperBoundVal() * dMultiplier);
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::AddDoubleAttribute
+//
+//	@doc:
+//		Add a double-valued attribute with full precision; the stream
+//		operator of CDouble prints six decimal places only, which loses
+//		small cost units
+//
+//---------------------------------------------------------------------------
+void
+CCostModelCalibrator::AddDoubleAttribute(CMemoryPool *mp,
+										 CXMLSerializer *xml_serializer,
+										 const CWStringConst *pstrAttr,
+										 CDouble dValue)
+{
+	CWStringDynamic str(mp);
+	str.AppendFormat(GPOS_WSZ_LIT("%.17g"), dValue.Get());
+	xml_serializer->AddAttribute(pstrAttr, &str);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::SerializeParams
+//
+//	@doc:
+//		Serialize all the given parameters as a DXL document with a
+//		top-level CostParams element, the form loaded by
+//		CParseHandlerDXL::GetCostModelParams; it is not the CostModelConfig
+//		element of an optimizer config. Values are written with full
+//		precision, so they parse back unchanged
+//
+//---------------------------------------------------------------------------
+void
+CCostModelCalibrator::SerializeParams(CMemoryPool *mp,
+									  CCostModelParamsGPDB *pcp,
+									  CStringDynamic *pstr)
+{
+	GPOS_ASSERT(NULL != pcp);
+	GPOS_ASSERT(NULL != pstr);
+
+	COstreamUTF8 os(pstr);
+	CXMLSerializer xml_serializer(mp, os, true /*indentation*/);
+
+	CDXLUtils::SerializeHeader(mp, &xml_serializer);
+
+	xml_serializer.OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenCostParams));
+
+	for (ULONG id = 0; id < CCostModelParamsGPDB::EcpSentinel; id++)
+	{
+		ICostModelParams::SCostParam *pcpParam = pcp->PcpLookup(id);
+
+		xml_serializer.OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenCostParam));
+		xml_serializer.AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenName),
+									pcp->SzNameLookup(id));
+		AddDoubleAttribute(mp, &xml_serializer,
+						   CDXLTokens::GetDXLTokenStr(EdxltokenValue),
+						   pcpParam->Get());
+		AddDoubleAttribute(
+			mp, &xml_serializer,
+			CDXLTokens::GetDXLTokenStr(EdxltokenCostParamLowerBound),
+			pcpParam->GetLowerBoundVal());
+		AddDoubleAttribute(
+			mp, &xml_serializer,
+			CDXLTokens::GetDXLTokenStr(EdxltokenCostParamUpperBound),
+			pcpParam->GetUpperBoundVal());
+		xml_serializer.CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenCostParam));
+	}
+
+	xml_serializer.CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenCostParams));
+
+	CDXLUtils::SerializeFooter(&xml_serializer);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelCalibrator::SzGroup
+//
+//	@doc:
+//		Name of the given group
+//
+//---------------------------------------------------------------------------
+const CHAR *
+CCostModelCalibrator::SzGroup(ECalibrationGroup ecg)
+{
+	GPOS_ASSERT(EcgSentinel > ecg);
+
+	return rgcgm[ecg].m_szName;
+}
+
+
+// EOF
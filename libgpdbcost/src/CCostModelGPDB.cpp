@@ -17,8 +17,10 @@
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPhysicalSequenceProject.h"
 #include "gpopt/operators/CPhysicalIndexScan.h"
+#include "gpopt/operators/CPhysicalIndexOnlyScan.h"
 #include "gpopt/operators/CPhysicalDynamicIndexScan.h"
 #include "gpopt/operators/CPhysicalHashAgg.h"
+#include "gpopt/operators/CPhysicalHashJoin.h"
 #include "gpopt/operators/CPhysicalUnionAll.h"
 #include "gpopt/operators/CPhysicalMotion.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
@@ -43,6 +45,7 @@ const CCostModelGPDB::SCostMapping CCostModelGPDB::m_rgcm[] = {
 	{COperator::EopPhysicalFilter, CostFilter},
 
 	{COperator::EopPhysicalIndexScan, CostIndexScan},
+	{COperator::EopPhysicalIndexOnlyScan, CostIndexScan},
 	{COperator::EopPhysicalDynamicIndexScan, CostIndexScan},
 	{COperator::EopPhysicalBitmapTableScan, CostBitmapTableScan},
 	{COperator::EopPhysicalDynamicBitmapTableScan, CostBitmapTableScan},
@@ -74,6 +77,8 @@ const CCostModelGPDB::SCostMapping CCostModelGPDB::m_rgcm[] = {
 	{COperator::EopPhysicalLeftAntiSemiHashJoin, CostHashJoin},
 	{COperator::EopPhysicalLeftAntiSemiHashJoinNotIn, CostHashJoin},
 	{COperator::EopPhysicalLeftOuterHashJoin, CostHashJoin},
+	{COperator::EopPhysicalFullOuterHashJoin, CostHashJoinPreservingInner},
+	{COperator::EopPhysicalRightOuterHashJoin, CostHashJoinPreservingInner},
 
 	{COperator::EopPhysicalInnerIndexNLJoin, CostIndexNLJoin},
 	{COperator::EopPhysicalLeftOuterIndexNLJoin, CostIndexNLJoin},
@@ -97,6 +102,8 @@ const CCostModelGPDB::SCostMapping CCostModelGPDB::m_rgcm[] = {
 	{COperator::EopPhysicalCorrelatedNotInLeftAntiSemiNLJoin, CostNLJoin},
 
 	{COperator::EopPhysicalFullMergeJoin, CostMergeJoin},
+	{COperator::EopPhysicalInnerMergeJoin, CostMergeJoin},
+	{COperator::EopPhysicalLeftOuterMergeJoin, CostMergeJoin},
 };
 
 //---------------------------------------------------------------------------
@@ -874,7 +881,9 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 				COperator::EopPhysicalLeftSemiHashJoin == op_id ||
 				COperator::EopPhysicalLeftAntiSemiHashJoin == op_id ||
 				COperator::EopPhysicalLeftAntiSemiHashJoinNotIn == op_id ||
-				COperator::EopPhysicalLeftOuterHashJoin == op_id);
+				COperator::EopPhysicalLeftOuterHashJoin == op_id ||
+				COperator::EopPhysicalFullOuterHashJoin == op_id ||
+				COperator::EopPhysicalRightOuterHashJoin == op_id);
 #endif	// GPOS_DEBUG
 
 	const DOUBLE num_rows_outer = pci->PdRows()[0];
@@ -951,6 +960,28 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	CColRefSet *pcrsUsed = pexprJoinCond->DeriveUsedColumns();
 	const ULONG ulColsUsed = pcrsUsed->Size();
 
+	// a runtime filter built from the hash table discards the rows of a table
+	// scan feeding the outer child before they reach the join
+	DOUBLE dRowsProbe = num_rows_outer;
+	DOUBLE dRuntimeFilterCost = 0.0;
+	CPhysicalHashJoin *popHJ = CPhysicalHashJoin::PopConvert(exprhdl.Pop());
+	if (GPOS_FTRACE(EopttraceEnableRuntimeJoinFilters))
+	{
+		CDouble dSelectivity =
+			popHJ->DRuntimeFilterSelectivity(num_rows_outer, pci->Rows());
+		if (dSelectivity < CDouble(1.0) &&
+			popHJ->FCanPlaceRuntimeFilter(mp, exprhdl))
+		{
+			dRowsProbe = num_rows_outer * dSelectivity.Get();
+
+			// cost of building the filter and probing it with every outer row
+			dRuntimeFilterCost =
+				ulColsUsed *
+				(dRowsInner * dHJHashTableColumnCostUnit.Get() +
+				 num_rows_outer * dJoinFeedingTupColumnCostUnit.Get());
+		}
+	}
+
 	// TODO 2014-03-14
 	// currently, we hard coded a spilling memory threshold for judging whether hash join spills or not
 	// In the future, we should calculate it based on the number of memory-intensive operators and statement memory available
@@ -972,9 +1003,11 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 				// cost of building hash table
 				dRowsInner * (ulColsUsed * dHJHashTableColumnCostUnit +
 							  dWidthInner * dHJHashTableWidthCostUnit) +
+				// cost of the runtime filter, if any
+				dRuntimeFilterCost +
 				// cost of feeding outer tuples
-				ulColsUsed * num_rows_outer * dJoinFeedingTupColumnCostUnit +
-				dWidthOuter * num_rows_outer * dJoinFeedingTupWidthCostUnit +
+				ulColsUsed * dRowsProbe * dJoinFeedingTupColumnCostUnit +
+				dWidthOuter * dRowsProbe * dJoinFeedingTupWidthCostUnit +
 				// cost of matching inner tuples
 				dWidthInner * dRowsInner * dHJHashingTupWidthCostUnit +
 				// cost of output tuples
@@ -991,8 +1024,9 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			(dHJHashTableInitCostFactor +
 			 dRowsInner * (ulColsUsed * dHJHashTableColumnCostUnit +
 						   dWidthInner * dHJHashTableWidthCostUnit) +
-			 ulColsUsed * num_rows_outer * dHJFeedingTupColumnSpillingCostUnit +
-			 dWidthOuter * num_rows_outer * dHJFeedingTupWidthSpillingCostUnit +
+			 dRuntimeFilterCost +
+			 ulColsUsed * dRowsProbe * dHJFeedingTupColumnSpillingCostUnit +
+			 dWidthOuter * dRowsProbe * dHJFeedingTupWidthSpillingCostUnit +
 			 dWidthInner * dRowsInner * dHJHashingTupWidthSpillingCostUnit +
 			 pci->Rows() * pci->Width() * dJoinOutputTupCostUnit));
 	}
@@ -1049,6 +1083,63 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	return costChild + CCost(costLocal.Get() * skew_ratio);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostHashJoinPreservingInner
+//
+//	@doc:
+//		Cost of a full or right outer hash join; this is the cost of a hash
+//		join plus the cost of scanning the hash table once more, after the
+//		outer tuples are consumed, to emit the unmatched inner tuples
+//
+//---------------------------------------------------------------------------
+CCost
+CCostModelGPDB::CostHashJoinPreservingInner(CMemoryPool *mp,
+											CExpressionHandle &exprhdl,
+											const CCostModelGPDB *pcmgpdb,
+											const SCostingInfo *pci)
+{
+	GPOS_ASSERT(NULL != pcmgpdb);
+	GPOS_ASSERT(NULL != pci);
+#ifdef GPOS_DEBUG
+	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
+	GPOS_ASSERT(COperator::EopPhysicalFullOuterHashJoin == op_id ||
+				COperator::EopPhysicalRightOuterHashJoin == op_id);
+#endif	// GPOS_DEBUG
+
+	const DOUBLE dRowsInner = pci->PdRows()[1];
+	const DOUBLE dWidthInner = pci->GetWidth()[1];
+
+	const CDouble dHJHashingTupWidthCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpHJHashingTupWidthCostUnit)
+			->Get();
+	const CDouble dHJSpillingMemThreshold =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpHJSpillingMemThreshold)
+			->Get();
+	const CDouble dHJHashingTupWidthSpillingCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(
+				CCostModelParamsGPDB::EcpHJHashingTupWidthSpillingCostUnit)
+			->Get();
+	GPOS_ASSERT(0 < dHJHashingTupWidthCostUnit);
+	GPOS_ASSERT(0 < dHJSpillingMemThreshold);
+	GPOS_ASSERT(0 < dHJHashingTupWidthSpillingCostUnit);
+
+	// a spilled hash table is read back from its batch files
+	CDouble dScanCostUnit = dHJHashingTupWidthCostUnit;
+	if (dRowsInner * dWidthInner > dHJSpillingMemThreshold)
+	{
+		dScanCostUnit = dHJHashingTupWidthSpillingCostUnit;
+	}
+
+	CCost costScanUnmatched = CCost(pci->NumRebinds() * dRowsInner *
+									dWidthInner * dScanCostUnit.Get());
+
+	return CostHashJoin(mp, exprhdl, pcmgpdb, pci) + costScanUnmatched;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostMergeJoin
@@ -1066,7 +1157,9 @@ CCostModelGPDB::CostMergeJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	GPOS_ASSERT(NULL != pci);
 #ifdef GPOS_DEBUG
 	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
-	GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id);
+	GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id ||
+				COperator::EopPhysicalInnerMergeJoin == op_id ||
+				COperator::EopPhysicalLeftOuterMergeJoin == op_id);
 #endif	// GPOS_DEBUG
 
 	const DOUBLE num_rows_outer = pci->PdRows()[0];
@@ -1519,8 +1612,7 @@ CCostModelGPDB::CostSequenceProject(CMemoryPool *mp, CExpressionHandle &exprhdl,
 //
 //---------------------------------------------------------------------------
 CCost
-CCostModelGPDB::CostIndexScan(CMemoryPool *,  // mp
-							  CExpressionHandle &exprhdl,
+CCostModelGPDB::CostIndexScan(CMemoryPool *mp, CExpressionHandle &exprhdl,
 							  const CCostModelGPDB *pcmgpdb,
 							  const SCostingInfo *pci)
 {
@@ -1530,10 +1622,19 @@ CCostModelGPDB::CostIndexScan(CMemoryPool *,  // mp
 	COperator *pop = exprhdl.Pop();
 	COperator::EOperatorId op_id = pop->Eopid();
 	GPOS_ASSERT(COperator::EopPhysicalIndexScan == op_id ||
+				COperator::EopPhysicalIndexOnlyScan == op_id ||
 				COperator::EopPhysicalDynamicIndexScan == op_id);
 
-	const CDouble dTableWidth =
-		CPhysicalScan::PopConvert(pop)->PstatsBaseTable()->Width();
+	IStatistics *pstatsBaseTable =
+		CPhysicalScan::PopConvert(pop)->PstatsBaseTable();
+	CDouble dTableWidth = pstatsBaseTable->Width();
+	if (COperator::EopPhysicalIndexOnlyScan == op_id)
+	{
+		// an index only scan reads the index tuples only, so the tuples it
+		// fetches are as wide as the index keys rather than the table
+		dTableWidth = pstatsBaseTable->Width(
+			mp, CPhysicalIndexOnlyScan::PopConvert(pop)->PcrsIndexKeys());
+	}
 
 	const CDouble dIndexFilterCostUnit =
 		pcmgpdb->GetCostModelParams()
@@ -1554,7 +1655,7 @@ CCostModelGPDB::CostIndexScan(CMemoryPool *,  // mp
 	CDouble dRowsIndex = pci->Rows();
 
 	ULONG ulIndexKeys = 1;
-	if (COperator::EopPhysicalIndexScan == op_id)
+	if (COperator::EopPhysicalDynamicIndexScan != op_id)
 	{
 		ulIndexKeys = CPhysicalIndexScan::PopConvert(pop)->Pindexdesc()->Keys();
 	}
@@ -76,6 +76,23 @@ private:
 	// type of this interval
 	IMDId *MdidType();
 
+	// do this interval and the given one consist only of points with native
+	// keys of the same domain
+	BOOL FNativePoints(CConstraintInterval *pci) const;
+
+	// union of two sorted arrays of points with native keys
+	static CRangeArray *PdrgprngUnionNativePoints(CMemoryPool *mp,
+												  CRangeArray *pdrgprngFst,
+												  CRangeArray *pdrgprngSnd);
+
+	// intersection of two sorted arrays of points with native keys
+	static CRangeArray *PdrgprngIntersectNativePoints(
+		CMemoryPool *mp, CRangeArray *pdrgprngFst, CRangeArray *pdrgprngSnd);
+
+	// difference of two sorted arrays of points with native keys
+	static CRangeArray *PdrgprngDifferenceNativePoints(
+		CMemoryPool *mp, CRangeArray *pdrgprngFst, CRangeArray *pdrgprngSnd);
+
 	// construct scalar expression
 	virtual CExpression *PexprConstructScalar(CMemoryPool *mp) const;
 
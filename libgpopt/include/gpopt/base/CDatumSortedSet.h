@@ -18,6 +18,13 @@ class CDatumSortedSet : public IDatumArray
 private:
 	BOOL m_fIncludesNull;
 
+	// sort and de-duplicate datums whose native keys belong to the same
+	// domain, comparing the keys inline
+	void SortNative(CMemoryPool *mp, IDatumArray *pdrgpdatum);
+
+	// sort and de-duplicate datums using the comparator
+	void SortGeneric(IDatumArray *pdrgpdatum, const IComparator *pcomp);
+
 public:
 	CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 					const IComparator *pcomp);
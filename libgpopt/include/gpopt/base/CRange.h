@@ -55,6 +55,20 @@ public:
 		EriSentinel
 	};
 
+	// domain of the inline 64-bit keys cached for the end points of a range;
+	// ranges with keys in the same domain are compared without going through
+	// the datum comparator
+	enum ENativeKey
+	{
+		EnkInt,			  // int2, int4 and int8
+		EnkOid,			  // oid
+		EnkBool,		  // bool
+		EnkDate,		  // date
+		EnkTimestamp,	  // timestamp
+		EnkTimestampTz,	  // timestamp with time zone
+		EnkNone			  // end points are compared using the comparator
+	};
+
 private:
 	// range type
 	IMDId *m_mdid;
@@ -74,6 +88,17 @@ private:
 	// inclusion option for right end
 	ERangeInclusion m_eriRight;
 
+	// domain of the native end point keys
+	ENativeKey m_enk;
+
+	// native key of left end point, valid if m_enk is not EnkNone and the
+	// left end is bounded
+	LINT m_lLeft;
+
+	// native key of right end point, valid if m_enk is not EnkNone and the
+	// right end is bounded
+	LINT m_lRight;
+
 	// hidden copy ctor
 	CRange(const CRange &);
 
@@ -98,6 +123,21 @@ private:
 		return EriIncluded;
 	}
 
+	// compute the native keys of the end points
+	void InitNativeKeys();
+
+	// are the end points of this range and the given range comparable
+	// using their native keys
+	BOOL
+	FNativeComparable(const CRange *prange) const
+	{
+		return EnkNone != m_enk && m_enk == prange->m_enk;
+	}
+
+	// three-way comparison of two bounded end points
+	INT ICompare(const IDatum *pdatumFst, LINT lFst, const IDatum *pdatumSnd,
+				 LINT lSnd, BOOL fNative) const;
+
 	// print a bound
 	IOstream &OsPrintBound(IOstream &os, IDatum *datum,
 						   const CHAR *szInfinity) const;
@@ -149,6 +189,28 @@ public:
 		return m_eriRight;
 	}
 
+	// native key domain of the end points
+	ENativeKey
+	Enk() const
+	{
+		return m_enk;
+	}
+
+	// native key of the left end point
+	LINT
+	LNativeLeft() const
+	{
+		GPOS_ASSERT(EnkNone != m_enk && NULL != m_pdatumLeft);
+
+		return m_lLeft;
+	}
+
+	// native key domain of a datum
+	static ENativeKey EnkDatum(IDatum *datum);
+
+	// native key of a datum with a native key domain
+	static LINT LNativeKey(IDatum *datum);
+
 	// is this range disjoint from the given range and to its left
 	BOOL FDisjointLeft(CRange *prange);
 
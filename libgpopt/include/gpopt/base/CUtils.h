@@ -558,6 +558,9 @@ public:
 	// check if a given operator is a physical outer join
 	static BOOL FPhysicalOuterJoin(COperator *pop);
 
+	// check if the given child of a physical join is null-extended
+	static BOOL FNullExtendedJoinChild(COperator *pop, ULONG child_index);
+
 	// check if a given operator is a physical scan
 	static BOOL FPhysicalScan(COperator *pop);
 
@@ -936,6 +939,9 @@ public:
 	// compares two CPoints, useful for sorting functions
 	static INT CPointCmp(const void *val1, const void *val2);
 
+	// compares two LINTs, useful for sorting native keys
+	static INT ILintCmp(const void *val1, const void *val2);
+
 	// check if the equivalance classes are disjoint
 	static BOOL FEquivalanceClassesDisjoint(CMemoryPool *mp,
 											const CColRefSetArray *pdrgpcrs);
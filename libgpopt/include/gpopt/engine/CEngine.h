@@ -12,6 +12,7 @@
 #define GPOPT_CEngine_H
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 
 #include "gpopt/xforms/CXform.h"
 #include "gpopt/search/CMemo.h"
@@ -33,6 +34,7 @@ class COptimizationContext;
 class CReqdPropPlan;
 class CReqdPropRelational;
 class CEnumeratorConfig;
+class COptimizationProfile;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -60,6 +62,39 @@ private:
 	// memo table
 	CMemo *m_pmemo;
 
+	// number of bytes the optimization may request from the memory pool
+	// before exploration stops; zero if no memory budget is set
+	ULLONG m_ullMemoryBudget;
+
+	// number of bytes requested from the memory pool before the engine was
+	// initialized
+	ULLONG m_ullRequestedAtInit;
+
+	// set once the memory budget is exceeded
+	BOOL m_fMemoryBudgetExceeded;
+
+	// time, in ms, the search may take; zero if no deadline is set
+	ULONG m_ulDeadline;
+
+	// time elapsed since the engine was initialized
+	CWallClock m_clockDeadline;
+
+	// set once the deadline is exceeded
+	BOOL m_fDeadlineExceeded;
+
+	// set once a search stage found a complete plan
+	BOOL m_fPlanFound;
+
+	// skip exploration xforms that recorded statistics show to be
+	// unproductive
+	BOOL m_fSkipUnproductiveXforms;
+
+	// number of cost contexts released by memo compaction
+	ULONG m_ulReleasedCostContexts;
+
+	// if set, collects time spent in each search stage
+	COptimizationProfile *m_pprofile;
+
 	//  pattern used for adding enforcers
 	CExpression *m_pexprEnforcerPattern;
 
@@ -159,8 +194,12 @@ private:
 	BOOL
 	FSearchTerminated() const
 	{
-		// at least one stage has completed and achieved required cost
-		return (NULL != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+		// at least one stage has completed and achieved required cost,
+		// the memory budget was exceeded, or the deadline was exceeded
+		// after a plan was found
+		return m_fMemoryBudgetExceeded ||
+			   (m_fDeadlineExceeded && m_fPlanFound) ||
+			   (NULL != PssPrevious() && PssPrevious()->FAchievedReqdCost());
 	}
 
 	// generate random plan id
@@ -346,6 +385,51 @@ public:
 		return (*m_search_stage_array)[m_ulCurrSearchStage - 1];
 	}
 
+	// set profile collecting time spent in each search stage
+	void
+	SetProfile(COptimizationProfile *pprofile)
+	{
+		m_pprofile = pprofile;
+	}
+
+	// check if memory consumption exceeded the memory budget
+	BOOL FMemoryBudgetExceeded();
+
+	// check if the optimization deadline has passed
+	BOOL FDeadlineExceeded();
+
+	// check if the current search stage must stop; this is the case when
+	// it timed out, or when the deadline passed and a plan was already found
+	BOOL FStageTimedOut();
+
+	// check if exploration is restricted to making groups implementable,
+	// after the memory budget or the deadline was exceeded
+	BOOL
+	FExplorationRestricted()
+	{
+		return FMemoryBudgetExceeded() || FDeadlineExceeded();
+	}
+
+	// check if an implementation xform applies to the given group expression
+	BOOL FImplementable(CGroupExpression *pgexpr);
+
+	// check if exploration xforms may be applied to the given group expression
+	BOOL FExplorationAllowed(CGroupExpression *pgexpr);
+
+	// check if unproductive exploration xforms are skipped
+	BOOL
+	FSkipUnproductiveXforms() const
+	{
+		return m_fSkipUnproductiveXforms;
+	}
+
+	// number of cost contexts released by memo compaction so far
+	ULONG
+	UlReleasedCostContexts() const
+	{
+		return m_ulReleasedCostContexts;
+	}
+
 	// number of search stages accessor
 	ULONG
 	UlSearchStages() const
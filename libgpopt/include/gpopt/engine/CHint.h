@@ -49,6 +49,10 @@ private:
 
 	ULONG m_ulPushGroupByBelowSetopThreshold;
 
+	ULONG m_ulMemoryBudget;
+
+	ULONG m_ulOptimizationDeadline;
+
 	// private copy ctor
 	CHint(const CHint &);
 
@@ -58,7 +62,8 @@ public:
 		  ULONG join_arity_for_associativity_commutativity,
 		  ULONG array_expansion_threshold, ULONG ulJoinOrderDPLimit,
 		  ULONG broadcast_threshold, BOOL enforce_constraint_on_dml,
-		  ULONG push_group_by_below_setop_threshold)
+		  ULONG push_group_by_below_setop_threshold, ULONG memory_budget,
+		  ULONG optimization_deadline)
 		: m_ulMinNumOfPartsToRequireSortOnInsert(
 			  min_num_of_parts_to_require_sort_on_insert),
 		  m_ulJoinArityForAssociativityCommutativity(
@@ -68,7 +73,9 @@ public:
 		  m_ulBroadcastThreshold(broadcast_threshold),
 		  m_fEnforceConstraintsOnDML(enforce_constraint_on_dml),
 		  m_ulPushGroupByBelowSetopThreshold(
-			  push_group_by_below_setop_threshold)
+			  push_group_by_below_setop_threshold),
+		  m_ulMemoryBudget(memory_budget),
+		  m_ulOptimizationDeadline(optimization_deadline)
 	{
 	}
 
@@ -134,6 +141,25 @@ public:
 		return m_ulPushGroupByBelowSetopThreshold;
 	}
 
+	// Memory, in KB, the optimization memory pool may grow to before ORCA
+	// stops exploring alternatives and settles for the best plan that can
+	// be implemented from the memo built so far. Zero disables the budget.
+	ULONG
+	UlMemoryBudget() const
+	{
+		return m_ulMemoryBudget;
+	}
+
+	// Time, in ms, the search may take before ORCA stops exploring
+	// alternatives and returns the best complete plan found so far. If no
+	// plan was found yet, the current search stage finishes implementing
+	// and optimizing the memo built so far. Zero disables the deadline.
+	ULONG
+	UlOptimizationDeadline() const
+	{
+		return m_ulOptimizationDeadline;
+	}
+
 	// generate default hint configurations, which disables sort during insert on
 	// append only row-oriented partitioned tables by default
 	static CHint *
@@ -146,7 +172,9 @@ public:
 			JOIN_ORDER_DP_THRESHOLD,			/*ulJoinOrderDPLimit*/
 			BROADCAST_THRESHOLD,				/*broadcast_threshold*/
 			true,								/* enforce_constraint_on_dml */
-			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD /* push_group_by_below_setop_threshold */
+			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, /* push_group_by_below_setop_threshold */
+			0, /* memory_budget */
+			0  /* optimization_deadline */
 		);
 	}
 
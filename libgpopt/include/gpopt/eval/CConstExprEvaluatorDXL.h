@@ -19,6 +19,7 @@
 #define GPOPT_CConstExprEvaluatorDXL_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
 
 #include "gpopt/eval/IConstExprEvaluator.h"
 #include "gpopt/base/CColRef.h"
@@ -27,6 +28,7 @@
 
 #include "naucrates/dxl/operators/CDXLNode.h"
 
+#include "naucrates/base/IDatum.h"
 #include "naucrates/md/CMDName.h"
 
 // forward declaration
@@ -48,10 +50,60 @@ class IConstDXLNodeEvaluator;
 //	@doc:
 //		Constant expression evaluator implementation that delegates to a DXL evaluator
 //
+//		Comparisons between constants of built-in types with native keys
+//		(integers, oids, booleans, dates and timestamps) are folded in
+//		process. Other comparisons are sent to the DXL evaluator, and their
+//		results are kept for the lifetime of the evaluator, i.e. the query,
+//		so that each distinct comparison is evaluated once
+//
 //---------------------------------------------------------------------------
 class CConstExprEvaluatorDXL : public IConstExprEvaluator
 {
 private:
+	// comparison between two constants, used as key of the folded results
+	struct SConstCmp
+	{
+		// comparison operator
+		IMDId *m_mdid_op;
+
+		// left constant
+		IDatum *m_pdatumLeft;
+
+		// right constant
+		IDatum *m_pdatumRight;
+
+		// ctor, takes ownership of the given objects
+		SConstCmp(IMDId *mdid_op, IDatum *pdatumLeft, IDatum *pdatumRight)
+			: m_mdid_op(mdid_op),
+			  m_pdatumLeft(pdatumLeft),
+			  m_pdatumRight(pdatumRight)
+		{
+		}
+
+		// dtor
+		~SConstCmp()
+		{
+			m_mdid_op->Release();
+			m_pdatumLeft->Release();
+			m_pdatumRight->Release();
+		}
+
+		// hash function
+		static ULONG HashValue(const SConstCmp *pcc);
+
+		// equality function
+		static BOOL Equals(const SConstCmp *pccFst, const SConstCmp *pccSnd);
+	};
+
+	// map of comparisons to their folded results
+	typedef CHashMap<SConstCmp, CExpression, SConstCmp::HashValue,
+					 SConstCmp::Equals, CleanupDelete<SConstCmp>,
+					 CleanupRelease<CExpression> >
+		ConstCmpToExprMap;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
 	// evaluates expressions represented as DXL, not owned
 	IConstDXLNodeEvaluator *m_pconstdxleval;
 
@@ -61,6 +113,13 @@ private:
 	// translates DXL coming from the evaluator back to CExpression
 	CTranslatorDXLToExpr m_trdxl2expr;
 
+	// results of comparisons evaluated by the DXL evaluator
+	ConstCmpToExprMap *m_phmccexpr;
+
+	// fold a comparison between constants with native keys; return NULL if
+	// the comparison cannot be folded in process
+	CExpression *PexprEvalNative(CExpression *pexpr) const;
+
 	// private copy ctor
 	CConstExprEvaluatorDXL(const CConstExprEvaluatorDXL &);
 
@@ -83,9 +83,10 @@ typedef IMDId *MdidPtr;
 //		metadata objects (such as aggregates and relations respectively). These
 //		methods in turn call the private method GetImdObj().
 //
-//		GetImdObj() first looks up the object in the MDCache. If no information
-//		is available in the cache, it goes to a CMDProvider (e.g., GPDB
-//		relcache or Minidump) to retrieve the required information.
+//		GetImdObj() first looks up the object in the built-in metadata
+//		preloaded by PreloadBuiltinMetadata(), then in the MDCache. If no
+//		information is available in either, it goes to a CMDProvider (e.g.,
+//		GPDB relcache or Minidump) to retrieve the required information.
 //
 //---------------------------------------------------------------------------
 class CMDAccessor
@@ -230,6 +231,17 @@ private:
 	// interface to a MD cache object
 	const IMDCacheObject *GetImdObj(IMDId *mdid);
 
+	// lookup an object in the preloaded built-in metadata; the returned
+	// object is pinned for the caller
+	IMDCacheObject *PimdobjBuiltin(IMDId *mdid);
+
+	// fetch an object from its MD provider into the preloaded built-in
+	// metadata unless it is there already
+	const IMDCacheObject *PimdobjPreload(IMDId *mdid);
+
+	// preload an object that may not exist; return false if it does not
+	BOOL FPreloadIfExists(IMDId *mdid);
+
 	// return the type corresponding to the given type info and source system id
 	const IMDType *RetrieveType(CSystemId sysid, IMDType::ETypeInfo type_info);
 
@@ -297,6 +309,12 @@ public:
 	void RegisterProviders(const CSystemIdArray *pdrgpsysid,
 						   const CMDProviderArray *pdrgpmdp);
 
+	// preload the built-in types of the given system, with their operators,
+	// aggregates and the casts and comparisons between them, into the
+	// built-in metadata shared by all accessors; return the number of
+	// objects preloaded
+	ULONG PreloadBuiltinMetadata(CSystemId sysid);
+
 	// interface to a relation object from the MD cache
 	const IMDRelation *RetrieveRel(IMDId *mdid);
 
@@ -40,6 +40,10 @@ private:
 	// pointer to the underlying cache
 	static CMDAccessor::MDCache *m_pcache;
 
+	// cache of built-in metadata preloaded at startup; it has no quota and
+	// is dropped along with the metadata cache on reset
+	static CMDAccessor::MDCache *m_pcacheBuiltin;
+
 	// the maximum size of the cache
 	static ULLONG m_ullCacheQuota;
 
@@ -52,6 +56,9 @@ private:
 	// private dtor
 	~CMDCache(){};
 
+	// create a metadata cache with the given quota
+	static CMDAccessor::MDCache *PcacheCreate(ULLONG ullCacheQuota);
+
 public:
 	// initialize underlying cache
 	static void Init();
@@ -78,6 +85,9 @@ public:
 	// reset global instance
 	static void Reset();
 
+	// drop all preloaded built-in metadata
+	static void ResetBuiltin();
+
 	// global accessor
 	static CMDAccessor::MDCache *
 	Pcache()
@@ -85,6 +95,13 @@ public:
 		return m_pcache;
 	}
 
+	// accessor of the cache of preloaded built-in metadata
+	static CMDAccessor::MDCache *
+	PcacheBuiltin()
+	{
+		return m_pcacheBuiltin;
+	}
+
 };	// class CMDCache
 
 }  // namespace gpopt
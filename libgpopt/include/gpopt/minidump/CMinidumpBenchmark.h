@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CMinidumpBenchmark.h
+//
+//	@doc:
+//		Repeated minidump replay measuring optimization time and memory
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CMinidumpBenchmark_H
+#define GPOPT_CMinidumpBenchmark_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/string/CStringDynamic.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMinidumpBenchmark
+//
+//	@doc:
+//		Replays minidumps a number of times and reports, per minidump, the
+//		median wall clock time of each phase, from parsing the DXL file to
+//		serializing the plan, along with the peak size of the optimizer
+//		memory pool and the size of the metadata cache.
+//
+//		The report is in CSV format, one line per minidump, and can be
+//		stored as a baseline; a later report is checked against it with a
+//		relative tolerance on the total time and the peak memory.
+//
+//---------------------------------------------------------------------------
+class CMinidumpBenchmark
+{
+public:
+	// measurements taken for each minidump; times are in micro-seconds,
+	// sizes are in bytes
+	enum EMeasure
+	{
+		EmParse = 0,		 // parsing the minidump file
+		EmTranslateQuery,	 // DXL query to logical expression
+		EmPreprocess,		 // query context generation and preprocessing
+		EmSearch,			 // all search stages and plan extraction
+		EmTranslatePlan,	 // physical expression to DXL plan
+		EmSerialize,		 // DXL plan to string
+		EmTotal,			 // all of the above
+		EmPeakMemory,		 // peak size of the optimizer memory pool
+		EmMDCacheMemory,	 // size of the metadata cache after optimization
+
+		EmSentinel
+	};
+
+private:
+	// median measurements of a single minidump
+	struct SResult
+	{
+		// minidump file name
+		CHAR *m_szFileName;
+
+		// median of each measurement
+		ULLONG m_rgullMeasure[EmSentinel];
+
+		// ctor
+		SResult(CMemoryPool *mp, const CHAR *szFileName);
+
+		// dtor
+		~SResult();
+	};
+
+	typedef CDynamicPtrArray<SResult, CleanupDelete> SResultArray;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of times each minidump is replayed
+	ULONG m_ulIterations;
+
+	// results of replayed minidumps
+	SResultArray *m_pdrgpresult;
+
+	// report in CSV format
+	CStringDynamic m_strReport;
+
+	// replay a minidump once, filling in measurements and search stage times
+	static void Replay(const CHAR *szFileName, ULLONG *rgullMeasure,
+					   ULLONG *rgullStage, ULONG ulMaxStages,
+					   ULONG *pulStages);
+
+	// sort the given measurements and return their median
+	static ULLONG UllMedian(ULLONG *rgull, ULONG size);
+
+	// parse a report line into a result; return NULL for malformed lines
+	SResult *PresultParse(const CHAR *szLine) const;
+
+	// find the result of the given minidump
+	SResult *PresultFind(const CHAR *szFileName) const;
+
+	// check a measurement against its baseline value
+	static BOOL FRegressed(ULLONG ullCurrent, ULLONG ullBaseline,
+						   ULONG ulTolerance);
+
+	// private copy ctor
+	CMinidumpBenchmark(const CMinidumpBenchmark &);
+
+public:
+	// ctor
+	CMinidumpBenchmark(CMemoryPool *mp, ULONG ulIterations);
+
+	// dtor
+	~CMinidumpBenchmark();
+
+	// replay the given minidump and add its measurements to the report
+	void Run(const CHAR *szFileName);
+
+	// report in CSV format
+	const CStringDynamic *
+	PstrReport() const
+	{
+		return &m_strReport;
+	}
+
+	// write report to the given file
+	void WriteReport(const CHAR *szFileName) const;
+
+	// check results against a baseline report, allowing the total time and
+	// the peak memory of each minidump to exceed their baseline values by
+	// the given percentage; regressions are traced and their number returned
+	ULONG UlRegressions(const CHAR *szBaselineFileName,
+						ULONG ulTolerance) const;
+
+	// column name of the given measurement in the report
+	static const CHAR *SzMeasure(EMeasure em);
+
+};	// class CMinidumpBenchmark
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CMinidumpBenchmark_H
+
+// EOF
@@ -25,6 +25,7 @@ class ICostModel;
 class CMiniDumperDXL;
 class COptimizerConfig;
 class IConstExprEvaluator;
+class COptimizationProfile;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -70,7 +71,7 @@ public:
 		CMemoryPool *mp, CMDAccessor *md_accessor, CDXLMinidump *pdxlmd,
 		const CHAR *file_name, ULONG ulSegments, ULONG ulSessionId,
 		ULONG ulCmdId, COptimizerConfig *optimizer_config,
-		IConstExprEvaluator *pceeval);
+		IConstExprEvaluator *pceeval, COptimizationProfile *pprofile = NULL);
 
 };	// class CMinidumperUtils
 
@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CJoinEliminator.h
+//
+//	@doc:
+//		Preprocessing routines that remove joins to relations contributing
+//		no output columns
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CJoinEliminator_H
+#define GPOPT_CJoinEliminator_H
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "naucrates/md/IMDRelation.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CJoinEliminator
+//
+//	@doc:
+//		Remove joins whose inner side contributes no output columns and
+//		matches every outer row exactly once:
+//
+//		(1) a left outer join whose predicate equates a key of the inner
+//			child to expressions over the outer child matches at most one
+//			inner row, and therefore produces exactly the outer child;
+//
+//		(2) an inner join of a relation with the relation referenced by one
+//			of its declared foreign keys, on exactly the foreign key columns,
+//			matches every row with a non-NULL key exactly once, and therefore
+//			produces the referencing child filtered on its non-NULL keys
+//
+//---------------------------------------------------------------------------
+class CJoinEliminator
+{
+private:
+	// private copy ctor
+	CJoinEliminator(const CJoinEliminator &);
+
+	// check if the operator needs only the columns required from it and
+	// the columns it uses from its children
+	static BOOL FPassThrough(COperator *pop);
+
+	// remove a left outer join to a unique key of its inner child
+	static CExpression *PexprEliminateLOJ(CMemoryPool *mp,
+										  CExpression *pexprLOJ,
+										  CColRefSet *pcrsReqd);
+
+	// remove an inner join child referenced by a foreign key of another child
+	static CExpression *PexprEliminateFKJoin(CMemoryPool *mp,
+											 CExpression *pexprJoin,
+											 CColRefSet *pcrsReqd);
+
+	// remove the given join child if it is referenced by a foreign key of
+	// another child through the join predicate
+	static CExpression *PexprRemoveReferencedChild(CMemoryPool *mp,
+												   CExpression *pexprJoin,
+												   ULONG ulReferenced);
+
+	// check if the given columns of the referencing expression form a
+	// declared foreign key to the given columns of the referenced Get
+	static BOOL FForeignKey(CMemoryPool *mp, CExpression *pexprReferencing,
+							CExpression *pexprReferenced,
+							CColRefArray *pdrgpcrKey,
+							CColRefArray *pdrgpcrReferenced);
+
+	// check if the given column pair appears in the given pair of arrays
+	static BOOL FContainsPair(CColRefArray *pdrgpcrFst,
+							  CColRefArray *pdrgpcrSnd, CColRef *pcrFst,
+							  CColRef *pcrSnd);
+
+	// find the Get operator producing the given column in the given tree
+	static CLogicalGet *PopGetProducing(CExpression *pexpr, CColRef *colref);
+
+	// find the output column of the Get for the given metadata position
+	static CColRef *PcrAtMDPos(CLogicalGet *popGet, const IMDRelation *pmdrel,
+							   ULONG ulPos);
+
+public:
+	// main driver; pcrsReqd are the columns required from the expression
+	static CExpression *PexprEliminateJoins(CMemoryPool *mp,
+											CExpression *pexpr,
+											CColRefSet *pcrsReqd);
+
+};	// class CJoinEliminator
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CJoinEliminator_H
+
+// EOF
@@ -81,6 +81,26 @@ private:
 	static BOOL FPushableThruSeqPrjChild(CExpression *pexprSeqPrj,
 										 CExpression *pexprPred);
 
+	// check if a scalar predicate restricts a column to a single value
+	static BOOL FPinsColumn(CExpression *pexprPred);
+
+	// check if the window functions of a sequence project produce the same
+	// values for its first rows when computed over a limit on its child,
+	// given the conjuncts pushed into that child
+	static BOOL FLimitableSeqPrj(CMemoryPool *mp, CExpression *pexprSeqPrj,
+								 CExpressionArray *pdrgpexprPushable);
+
+	// return the number of rows a filter on a row number computed by a
+	// sequence project lets through, or -1 if it is not such a filter
+	static LINT LRowNumberLimit(CExpression *pexprSeqPrj,
+								CExpression *pexprPred);
+
+	// add a limit on top of the new child of a sequence project that is
+	// filtered on a row number
+	static CExpression *PexprAddTopKBelowSeqPrj(
+		CMemoryPool *mp, CExpression *pexprSeqPrj, CExpression *pexprChild,
+		CExpressionArray *pdrgpexprUnpushable);
+
 	// check if a conjunct should be pushed through expression's outer child
 	static BOOL FPushThruOuterChild(CExpression *pexprLogical);
 
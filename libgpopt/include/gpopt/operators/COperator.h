@@ -107,6 +107,7 @@ public:
 		EopLogicalLeftAntiSemiJoin,
 		EopLogicalLeftAntiSemiJoinNotIn,
 		EopLogicalFullOuterJoin,
+		EopLogicalRightOuterJoin,
 		EopLogicalGbAgg,
 		EopLogicalGbAggDeduplicate,
 		EopLogicalLimit,
@@ -259,6 +260,12 @@ public:
 		EopLogicalDynamicBitmapTableGet,
 		EopPhysicalDynamicBitmapTableScan,
 
+		EopPhysicalIndexOnlyScan,
+		EopPhysicalFullOuterHashJoin,
+		EopPhysicalRightOuterHashJoin,
+		EopPhysicalInnerMergeJoin,
+		EopPhysicalLeftOuterMergeJoin,
+
 		EopSentinel
 	};
 
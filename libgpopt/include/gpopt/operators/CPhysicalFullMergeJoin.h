@@ -5,20 +5,16 @@
 #define GPOPT_CPhysicalFullMergeJoin_H
 
 #include "gpos/base.h"
-#include "gpopt/operators/CPhysicalJoin.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 
 namespace gpopt
 {
-class CPhysicalFullMergeJoin : public CPhysicalJoin
+class CPhysicalFullMergeJoin : public CPhysicalMergeJoin
 {
 private:
 	// private copy ctor
 	CPhysicalFullMergeJoin(const CPhysicalFullMergeJoin &);
 
-	CExpressionArray *m_outer_merge_clauses;
-
-	CExpressionArray *m_inner_merge_clauses;
-
 public:
 	// ctor
 	explicit CPhysicalFullMergeJoin(CMemoryPool *mp,
@@ -51,37 +47,6 @@ public:
 		return dynamic_cast<CPhysicalFullMergeJoin *>(pop);
 	}
 
-	virtual CDistributionSpec *PdsRequired(CMemoryPool *mp,
-										   CExpressionHandle &exprhdl,
-										   CDistributionSpec *pdsRequired,
-										   ULONG child_index,
-										   CDrvdPropArray *pdrgpdpCtxt,
-										   ULONG ulOptReq) const;
-
-	virtual COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
-									COrderSpec *posInput, ULONG child_index,
-									CDrvdPropArray *pdrgpdpCtxt,
-									ULONG ulOptReq) const;
-
-	// compute required rewindability of the n-th child
-	virtual CRewindabilitySpec *PrsRequired(CMemoryPool *mp,
-											CExpressionHandle &exprhdl,
-											CRewindabilitySpec *prsRequired,
-											ULONG child_index,
-											CDrvdPropArray *pdrgpdpCtxt,
-											ULONG ulOptReq) const;
-
-	// return order property enforcing type for this operator
-	virtual CEnfdProp::EPropEnforcingType EpetOrder(
-		CExpressionHandle &exprhdl, const CEnfdOrder *peo) const;
-
-	virtual CEnfdDistribution::EDistributionMatching Edm(
-		CReqdPropPlan *,   // prppInput
-		ULONG,			   //child_index,
-		CDrvdPropArray *,  // pdrgpdpCtxt,
-		ULONG			   // ulOptReq
-	);
-
 	virtual CDistributionSpec *PdsDerive(CMemoryPool *mp,
 										 CExpressionHandle &exprhdl) const;
 
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalFullOuterHashJoin.h
+//
+//	@doc:
+//		Full outer hash join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalFullOuterHashJoin_H
+#define GPOPT_CPhysicalFullOuterHashJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalHashJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalFullOuterHashJoin
+//
+//	@doc:
+//		Full outer hash join operator; unmatched rows of both children are
+//		emitted, so the children can never be broadcast and are either
+//		co-located on the hash join keys or both gathered on a single host
+//
+//---------------------------------------------------------------------------
+class CPhysicalFullOuterHashJoin : public CPhysicalHashJoin
+{
+private:
+	// private copy ctor
+	CPhysicalFullOuterHashJoin(const CPhysicalFullOuterHashJoin &);
+
+public:
+	// ctor
+	CPhysicalFullOuterHashJoin(CMemoryPool *mp,
+							   CExpressionArray *pdrgpexprOuterKeys,
+							   CExpressionArray *pdrgpexprInnerKeys);
+
+	// dtor
+	virtual ~CPhysicalFullOuterHashJoin();
+
+	// ident accessors
+	virtual EOperatorId
+	Eopid() const
+	{
+		return EopPhysicalFullOuterHashJoin;
+	}
+
+	// return a string for operator name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CPhysicalFullOuterHashJoin";
+	}
+
+	// compute required distribution of the n-th child
+	virtual CDistributionSpec *PdsRequired(CMemoryPool *mp,
+										   CExpressionHandle &exprhdl,
+										   CDistributionSpec *pdsRequired,
+										   ULONG child_index,
+										   CDrvdPropArray *pdrgpdpCtxt,
+										   ULONG ulOptReq) const;
+
+	// distribution matching type
+	virtual CEnfdDistribution::EDistributionMatching Edm(
+		CReqdPropPlan *prppInput, ULONG child_index,
+		CDrvdPropArray *pdrgpdpCtxt, ULONG ulOptReq);
+
+	// derive distribution
+	virtual CDistributionSpec *PdsDerive(CMemoryPool *mp,
+										 CExpressionHandle &exprhdl) const;
+
+	// conversion function
+	static CPhysicalFullOuterHashJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(NULL != pop);
+		GPOS_ASSERT(EopPhysicalFullOuterHashJoin == pop->Eopid());
+
+		return dynamic_cast<CPhysicalFullOuterHashJoin *>(pop);
+	}
+
+};	// class CPhysicalFullOuterHashJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalFullOuterHashJoin_H
+
+// EOF
@@ -73,13 +73,6 @@ private:
 											CDrvdPropArray *pdrgpdpCtxt,
 											ULONG ulOptReq) const;
 
-	// create (singleton, singleton) optimization request
-	CDistributionSpec *PdsRequiredSingleton(CMemoryPool *mp,
-											CExpressionHandle &exprhdl,
-											CDistributionSpec *pdsInput,
-											ULONG child_index,
-											CDrvdPropArray *pdrgpdpCtxt) const;
-
 	// create a child hashed distribution request based on input hashed distribution,
 	// return NULL if no such request can be created
 	CDistributionSpecHashed *PdshashedPassThru(
@@ -100,6 +93,36 @@ protected:
 	// check whether the hash keys from one child are nullable
 	BOOL FNullableHashKeys(CColRefSet *pcrsNotNullInner, BOOL fInner) const;
 
+	// create (singleton, singleton) optimization request
+	CDistributionSpec *PdsRequiredSingleton(CMemoryPool *mp,
+											CExpressionHandle &exprhdl,
+											CDistributionSpec *pdsInput,
+											ULONG child_index,
+											CDrvdPropArray *pdrgpdpCtxt) const;
+
+	// compute required distribution of the n-th child for a hash join that
+	// emits the unmatched rows of its inner child, and therefore must not
+	// have it broadcast
+	CDistributionSpec *PdsRequiredNoBroadcast(CMemoryPool *mp,
+											  CExpressionHandle &exprhdl,
+											  CDistributionSpec *pdsRequired,
+											  ULONG child_index,
+											  CDrvdPropArray *pdrgpdpCtxt,
+											  ULONG ulOptReq) const;
+
+	// check if the probe side operator the handle is attached to passes on
+	// the given keys from a table scan, without crossing a motion
+	static BOOL FRuntimeFilterKeysFromScan(CMemoryPool *mp,
+										   CExpressionHandle &exprhdl,
+										   CColRefSet *pcrsKeys);
+
+	// number of (redistribute, redistribute) optimization requests
+	ULONG
+	UlHashDistributeRequests() const
+	{
+		return m_pdrgpdsRedistributeRequests->Size();
+	}
+
 public:
 	// ctor
 	CPhysicalHashJoin(CMemoryPool *mp, CExpressionArray *pdrgpexprOuterKeys,
@@ -122,6 +145,16 @@ public:
 		return m_pdrgpexprOuterKeys;
 	}
 
+	// estimated fraction of outer rows passing a runtime filter built from
+	// the hash table, or 1.0 if the filter is not worth building
+	CDouble DRuntimeFilterSelectivity(CDouble dRowsOuter,
+									  CDouble dRowsJoin) const;
+
+	// check if a runtime filter built from the hash table can be applied by
+	// a table scan on the probe side of the join the handle is attached to
+	BOOL FCanPlaceRuntimeFilter(CMemoryPool *mp,
+								CExpressionHandle &exprhdl) const;
+
 	//-------------------------------------------------------------------------------------
 	// Required Plan Properties
 	//-------------------------------------------------------------------------------------
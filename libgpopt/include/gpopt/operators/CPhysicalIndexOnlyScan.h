@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalIndexOnlyScan.h
+//
+//	@doc:
+//		Physical index only scan operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalIndexOnlyScan_H
+#define GPOPT_CPhysicalIndexOnlyScan_H
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalIndexScan.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalIndexOnlyScan
+//
+//	@doc:
+//		Index scan that returns columns from the index tuples without
+//		fetching the heap tuples; it only provides the index key columns
+//
+//---------------------------------------------------------------------------
+class CPhysicalIndexOnlyScan : public CPhysicalIndexScan
+{
+private:
+	// output columns stored in the index
+	CColRefSet *m_pcrsIndexKeys;
+
+	// private copy ctor
+	CPhysicalIndexOnlyScan(const CPhysicalIndexOnlyScan &);
+
+public:
+	// ctor
+	CPhysicalIndexOnlyScan(CMemoryPool *mp, CIndexDescriptor *pindexdesc,
+						   CTableDescriptor *ptabdesc, ULONG ulOriginOpId,
+						   const CName *pnameAlias, CColRefArray *colref_array,
+						   COrderSpec *pos, CColRefSet *pcrsIndexKeys);
+
+	// dtor
+	virtual ~CPhysicalIndexOnlyScan();
+
+	// ident accessors
+	virtual EOperatorId
+	Eopid() const
+	{
+		return EopPhysicalIndexOnlyScan;
+	}
+
+	// operator name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CPhysicalIndexOnlyScan";
+	}
+
+	// output columns stored in the index
+	CColRefSet *
+	PcrsIndexKeys() const
+	{
+		return m_pcrsIndexKeys;
+	}
+
+	// check if required columns are stored in the index
+	virtual BOOL FProvidesReqdCols(CExpressionHandle &exprhdl,
+								   CColRefSet *pcrsRequired,
+								   ULONG ulOptReq) const;
+
+	// conversion function
+	static CPhysicalIndexOnlyScan *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(NULL != pop);
+		GPOS_ASSERT(EopPhysicalIndexOnlyScan == pop->Eopid());
+
+		return dynamic_cast<CPhysicalIndexOnlyScan *>(pop);
+	}
+
+};	// class CPhysicalIndexOnlyScan
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalIndexOnlyScan_H
+
+// EOF
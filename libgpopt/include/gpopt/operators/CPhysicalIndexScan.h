@@ -153,7 +153,8 @@ public:
 	PopConvert(COperator *pop)
 	{
 		GPOS_ASSERT(NULL != pop);
-		GPOS_ASSERT(EopPhysicalIndexScan == pop->Eopid());
+		GPOS_ASSERT(EopPhysicalIndexScan == pop->Eopid() ||
+					EopPhysicalIndexOnlyScan == pop->Eopid());
 
 		return dynamic_cast<CPhysicalIndexScan *>(pop);
 	}
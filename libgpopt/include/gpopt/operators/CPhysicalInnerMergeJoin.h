@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalInnerMergeJoin.h
+//
+//	@doc:
+//		Inner merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalInnerMergeJoin_H
+#define GPOPT_CPhysicalInnerMergeJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Inner merge join operator; join conjuncts other than the merge
+//		clauses are evaluated as a join filter
+//
+//---------------------------------------------------------------------------
+class CPhysicalInnerMergeJoin : public CPhysicalMergeJoin
+{
+private:
+	// private copy ctor
+	CPhysicalInnerMergeJoin(const CPhysicalInnerMergeJoin &);
+
+public:
+	// ctor
+	CPhysicalInnerMergeJoin(CMemoryPool *mp,
+							CExpressionArray *outer_merge_clauses,
+							CExpressionArray *inner_merge_clauses);
+
+	// dtor
+	virtual ~CPhysicalInnerMergeJoin();
+
+	// ident accessors
+	virtual EOperatorId
+	Eopid() const
+	{
+		return EopPhysicalInnerMergeJoin;
+	}
+
+	// return a string for operator name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CPhysicalInnerMergeJoin";
+	}
+
+	// conversion function
+	static CPhysicalInnerMergeJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(EopPhysicalInnerMergeJoin == pop->Eopid());
+
+		return dynamic_cast<CPhysicalInnerMergeJoin *>(pop);
+	}
+
+	// derive distribution
+	virtual CDistributionSpec *PdsDerive(CMemoryPool *mp,
+										 CExpressionHandle &exprhdl) const;
+
+};	// class CPhysicalInnerMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalInnerMergeJoin_H
+
+// EOF
@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalLeftOuterMergeJoin.h
+//
+//	@doc:
+//		Left outer merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalLeftOuterMergeJoin_H
+#define GPOPT_CPhysicalLeftOuterMergeJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Left outer merge join operator; the inner child is null-extended,
+//		so the join is distributed like its outer child
+//
+//---------------------------------------------------------------------------
+class CPhysicalLeftOuterMergeJoin : public CPhysicalMergeJoin
+{
+private:
+	// private copy ctor
+	CPhysicalLeftOuterMergeJoin(const CPhysicalLeftOuterMergeJoin &);
+
+public:
+	// ctor
+	CPhysicalLeftOuterMergeJoin(CMemoryPool *mp,
+								CExpressionArray *outer_merge_clauses,
+								CExpressionArray *inner_merge_clauses);
+
+	// dtor
+	virtual ~CPhysicalLeftOuterMergeJoin();
+
+	// ident accessors
+	virtual EOperatorId
+	Eopid() const
+	{
+		return EopPhysicalLeftOuterMergeJoin;
+	}
+
+	// return a string for operator name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CPhysicalLeftOuterMergeJoin";
+	}
+
+	// conversion function
+	static CPhysicalLeftOuterMergeJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(EopPhysicalLeftOuterMergeJoin == pop->Eopid());
+
+		return dynamic_cast<CPhysicalLeftOuterMergeJoin *>(pop);
+	}
+
+};	// class CPhysicalLeftOuterMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalLeftOuterMergeJoin_H
+
+// EOF
@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalMergeJoin.h
+//
+//	@doc:
+//		Base merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalMergeJoin_H
+#define GPOPT_CPhysicalMergeJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalMergeJoin
+//
+//	@doc:
+//		Base merge join operator; both children are required to be sorted
+//		on the merge clauses and co-located on them, or on a single host
+//
+//---------------------------------------------------------------------------
+class CPhysicalMergeJoin : public CPhysicalJoin
+{
+private:
+	// private copy ctor
+	CPhysicalMergeJoin(const CPhysicalMergeJoin &);
+
+	// merge clauses of the outer child
+	CExpressionArray *m_outer_merge_clauses;
+
+	// merge clauses of the inner child
+	CExpressionArray *m_inner_merge_clauses;
+
+public:
+	// ctor
+	CPhysicalMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+					   CExpressionArray *inner_merge_clauses);
+
+	// dtor
+	virtual ~CPhysicalMergeJoin();
+
+	// merge clauses of the outer child
+	CExpressionArray *
+	PdrgpexprOuterMergeClauses() const
+	{
+		return m_outer_merge_clauses;
+	}
+
+	// merge clauses of the inner child
+	CExpressionArray *
+	PdrgpexprInnerMergeClauses() const
+	{
+		return m_inner_merge_clauses;
+	}
+
+	virtual CDistributionSpec *PdsRequired(CMemoryPool *mp,
+										   CExpressionHandle &exprhdl,
+										   CDistributionSpec *pdsRequired,
+										   ULONG child_index,
+										   CDrvdPropArray *pdrgpdpCtxt,
+										   ULONG ulOptReq) const;
+
+	virtual COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+									COrderSpec *posInput, ULONG child_index,
+									CDrvdPropArray *pdrgpdpCtxt,
+									ULONG ulOptReq) const;
+
+	// compute required rewindability of the n-th child
+	virtual CRewindabilitySpec *PrsRequired(CMemoryPool *mp,
+											CExpressionHandle &exprhdl,
+											CRewindabilitySpec *prsRequired,
+											ULONG child_index,
+											CDrvdPropArray *pdrgpdpCtxt,
+											ULONG ulOptReq) const;
+
+	// return order property enforcing type for this operator
+	virtual CEnfdProp::EPropEnforcingType EpetOrder(
+		CExpressionHandle &exprhdl, const CEnfdOrder *peo) const;
+
+	virtual CEnfdDistribution::EDistributionMatching Edm(
+		CReqdPropPlan *,   // prppInput
+		ULONG,			   //child_index,
+		CDrvdPropArray *,  // pdrgpdpCtxt,
+		ULONG			   // ulOptReq
+	);
+
+	// conversion function
+	static CPhysicalMergeJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(NULL != dynamic_cast<CPhysicalMergeJoin *>(pop));
+
+		return dynamic_cast<CPhysicalMergeJoin *>(pop);
+	}
+
+};	// class CPhysicalMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalMergeJoin_H
+
+// EOF
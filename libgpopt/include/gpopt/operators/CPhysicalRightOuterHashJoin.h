@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalRightOuterHashJoin.h
+//
+//	@doc:
+//		Right outer hash join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalRightOuterHashJoin_H
+#define GPOPT_CPhysicalRightOuterHashJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalHashJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalRightOuterHashJoin
+//
+//	@doc:
+//		Right outer hash join operator; the hash table is built on the inner
+//		child, which is the preserved side of the join, and the outer child
+//		is null-extended; a left outer join with its children swapped
+//
+//---------------------------------------------------------------------------
+class CPhysicalRightOuterHashJoin : public CPhysicalHashJoin
+{
+private:
+	// private copy ctor
+	CPhysicalRightOuterHashJoin(const CPhysicalRightOuterHashJoin &);
+
+public:
+	// ctor
+	CPhysicalRightOuterHashJoin(CMemoryPool *mp,
+								CExpressionArray *pdrgpexprOuterKeys,
+								CExpressionArray *pdrgpexprInnerKeys);
+
+	// dtor
+	virtual ~CPhysicalRightOuterHashJoin();
+
+	// ident accessors
+	virtual EOperatorId
+	Eopid() const
+	{
+		return EopPhysicalRightOuterHashJoin;
+	}
+
+	// return a string for operator name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CPhysicalRightOuterHashJoin";
+	}
+
+	// compute required distribution of the n-th child
+	virtual CDistributionSpec *PdsRequired(CMemoryPool *mp,
+										   CExpressionHandle &exprhdl,
+										   CDistributionSpec *pdsRequired,
+										   ULONG child_index,
+										   CDrvdPropArray *pdrgpdpCtxt,
+										   ULONG ulOptReq) const;
+
+	// distribution matching type
+	virtual CEnfdDistribution::EDistributionMatching Edm(
+		CReqdPropPlan *prppInput, ULONG child_index,
+		CDrvdPropArray *pdrgpdpCtxt, ULONG ulOptReq);
+
+	// derive distribution
+	virtual CDistributionSpec *PdsDerive(CMemoryPool *mp,
+										 CExpressionHandle &exprhdl) const;
+
+	// conversion function
+	static CPhysicalRightOuterHashJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(NULL != pop);
+		GPOS_ASSERT(EopPhysicalRightOuterHashJoin == pop->Eopid());
+
+		return dynamic_cast<CPhysicalRightOuterHashJoin *>(pop);
+	}
+
+};	// class CPhysicalRightOuterHashJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalRightOuterHashJoin_H
+
+// EOF
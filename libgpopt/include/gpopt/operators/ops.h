@@ -74,6 +74,7 @@
 #include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/operators/CLogicalNAryJoin.h"
 #include "gpopt/operators/CLogicalLeftOuterJoin.h"
+#include "gpopt/operators/CLogicalRightOuterJoin.h"
 #include "gpopt/operators/CLogicalLeftSemiJoin.h"
 #include "gpopt/operators/CLogicalLeftAntiSemiJoin.h"
 #include "gpopt/operators/CLogicalLeftAntiSemiJoinNotIn.h"
@@ -119,6 +120,7 @@
 #include "gpopt/operators/CPhysicalTableScan.h"
 #include "gpopt/operators/CPhysicalExternalScan.h"
 #include "gpopt/operators/CPhysicalIndexScan.h"
+#include "gpopt/operators/CPhysicalIndexOnlyScan.h"
 #include "gpopt/operators/CPhysicalBitmapTableScan.h"
 #include "gpopt/operators/CPhysicalFilter.h"
 #include "gpopt/operators/CPhysicalHashJoin.h"
@@ -128,6 +130,10 @@
 #include "gpopt/operators/CPhysicalCorrelatedInnerNLJoin.h"
 #include "gpopt/operators/CPhysicalLeftOuterIndexNLJoin.h"
 #include "gpopt/operators/CPhysicalLeftOuterHashJoin.h"
+#include "gpopt/operators/CPhysicalFullOuterHashJoin.h"
+#include "gpopt/operators/CPhysicalRightOuterHashJoin.h"
+#include "gpopt/operators/CPhysicalInnerMergeJoin.h"
+#include "gpopt/operators/CPhysicalLeftOuterMergeJoin.h"
 #include "gpopt/operators/CPhysicalLeftOuterNLJoin.h"
 #include "gpopt/operators/CPhysicalCorrelatedLeftOuterNLJoin.h"
 #include "gpopt/operators/CPhysicalLeftSemiHashJoin.h"
@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		COptimizationProfile.h
+//
+//	@doc:
+//		Wall clock time spent in the phases of optimizing a query
+//---------------------------------------------------------------------------
+#ifndef GPOPT_COptimizationProfile_H
+#define GPOPT_COptimizationProfile_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CWallClock.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COptimizationProfile
+//
+//	@doc:
+//		Collects the time, in micro-seconds, spent in each optimization
+//		phase and search stage of a query. A profile is optional; it is
+//		passed down by callers that measure optimization, such as the
+//		minidump benchmark, and accumulates over repeated optimizations
+//		until it is reset.
+//
+//---------------------------------------------------------------------------
+class COptimizationProfile
+{
+public:
+	// timed optimization phases
+	enum EPhase
+	{
+		EphTranslateQuery = 0,	// DXL query to logical expression
+		EphPreprocess,			// query context generation and preprocessing
+		EphSearch,				// all search stages and plan extraction
+		EphTranslatePlan,		// physical expression to DXL plan
+
+		EphSentinel
+	};
+
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// clock measuring the current phase
+	CWallClock m_clock;
+
+	// time spent in each phase
+	ULONG m_rgulPhaseTime[EphSentinel];
+
+	// time spent in each search stage
+	ULongPtrArray *m_pdrgpulStageTime;
+
+	// private copy ctor
+	COptimizationProfile(const COptimizationProfile &);
+
+public:
+	// ctor
+	explicit COptimizationProfile(CMemoryPool *mp);
+
+	// dtor
+	~COptimizationProfile();
+
+	// start timing a new phase
+	void
+	StartPhase()
+	{
+		m_clock.Restart();
+	}
+
+	// add the time elapsed since the last phase started to the given phase,
+	// and start timing the next one
+	void StopPhase(EPhase eph);
+
+	// add the time spent in the given search stage
+	void RecordSearchStage(ULONG ulStage, ULONG ulTime);
+
+	// time spent in the given phase
+	ULONG
+	UlPhaseTime(EPhase eph) const
+	{
+		GPOS_ASSERT(EphSentinel > eph);
+
+		return m_rgulPhaseTime[eph];
+	}
+
+	// number of search stages recorded
+	ULONG
+	UlSearchStages() const
+	{
+		return m_pdrgpulStageTime->Size();
+	}
+
+	// time spent in the given search stage
+	ULONG
+	UlSearchStageTime(ULONG ulStage) const
+	{
+		return *(*m_pdrgpulStageTime)[ulStage];
+	}
+
+	// reset all measurements
+	void Reset();
+
+	// name of the given phase
+	static const CHAR *SzPhase(EPhase eph);
+
+};	// class COptimizationProfile
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_COptimizationProfile_H
+
+// EOF
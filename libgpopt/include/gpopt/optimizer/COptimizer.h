@@ -38,6 +38,7 @@ class ICostModel;
 class COptimizerConfig;
 class CQueryContext;
 class CEnumeratorConfig;
+class COptimizationProfile;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -55,7 +56,8 @@ private:
 
 	// optimize query in the given query context
 	static CExpression *PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-									  CSearchStageArray *search_stage_array);
+									  CSearchStageArray *search_stage_array,
+									  COptimizationProfile *pprofile);
 
 	// translate an optimizer expression into a DXL tree
 	static CDXLNode *CreateDXLNode(CMemoryPool *mp, CMDAccessor *md_accessor,
@@ -97,7 +99,9 @@ public:
 		CSearchStageArray *search_stage_array,	// search strategy
 		COptimizerConfig *optimizer_config,		// optimizer configurations
 		const CHAR *szMinidumpFileName =
-			NULL  // name of minidump file to be created
+			NULL,  // name of minidump file to be created
+		COptimizationProfile *pprofile =
+			NULL  // if given, collects time spent in optimization phases
 	);
 };	// class COptimizer
 }  // namespace gpopt
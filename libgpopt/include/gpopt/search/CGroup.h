@@ -491,6 +491,9 @@ public:
 	// reset group job queues
 	void ResetGroupJobQueues();
 
+	// release dominated cost contexts of group expressions
+	ULONG UlReleaseDominatedContexts();
+
 	// check if group has duplicates
 	BOOL
 	FDuplicateGroup() const
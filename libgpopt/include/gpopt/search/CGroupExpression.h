@@ -227,6 +227,11 @@ public:
 	// cleanup cost contexts
 	void CleanupContexts();
 
+	// release cost contexts that are not the best of their optimization
+	// context, and cached partial plan costs; return the number of released
+	// cost contexts
+	ULONG UlReleaseDominatedContexts();
+
 	// check if cost context already exists in group expression hash table
 	BOOL FCostContextExists(COptimizationContext *poc,
 							COptimizationContextArray *pdrgpoc);
@@ -77,6 +77,11 @@ private:
 	// private copy ctor
 	CJobGroupExpressionExploration(const CJobGroupExpressionExploration &);
 
+	// schedule transformation jobs once exploration is restricted, so that
+	// the cheapest join order expansion runs first
+	void ScheduleRestrictedTransformations(CSchedulerContext *psc,
+										   CXformSet *xform_set);
+
 protected:
 	// schedule transformation jobs for applicable xforms
 	virtual void ScheduleApplicableTransformations(CSchedulerContext *psc);
@@ -143,8 +143,8 @@ public:
 		TEnumState estNext = estSentinel;
 		do
 		{
-			// check if current search stage is timed-out
-			if (psc->Peng()->PssCurrent()->FTimedOut())
+			// check if current search stage is timed-out or past the deadline
+			if (psc->Peng()->FStageTimedOut())
 			{
 				// cleanup job state and terminate state machine
 				pjOwner->Cleanup();
@@ -154,6 +154,9 @@ public:
 	// reset states of all memo groups
 	void ResetGroupStates();
 
+	// release cost contexts that cannot be used by later search stages
+	ULONG UlCompact();
+
 	// reset statistics of memo groups
 	void ResetStats();
 
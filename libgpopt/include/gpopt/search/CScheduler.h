@@ -18,7 +18,6 @@
 #include "gpopt/search/CJob.h"
 
 #define OPT_SCHED_QUEUED_RUNNING_RATIO 10
-#define OPT_SCHED_CFA 100
 
 namespace gpopt
 {
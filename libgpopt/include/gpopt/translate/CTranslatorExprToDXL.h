@@ -126,6 +126,9 @@ private:
 	// id of master node
 	INT m_iMasterId;
 
+	// id of the next runtime filter placed by a hash join
+	ULONG m_ulNextRuntimeFilterId;
+
 	// scalar expression translators indexed by the operator id
 	PfPdxlnScalar m_rgpfScalarTranslators[COperator::EopSentinel];
 
@@ -291,6 +294,15 @@ private:
 							CDistributionSpecArray *pdrgpdsBaseTables,
 							ULONG *pulNonGatherMotions, BOOL *pfDML);
 
+	// annotate a selective hash join with a runtime filter applied by a
+	// table scan on its probe side
+	void AddRuntimeFilter(CExpression *pexprHJ, CDXLNode *pdxlnHJ);
+
+	// find the table scan producing the given probe side keys, if they are
+	// passed on to the join without crossing a slice boundary
+	static CDXLNode *PdxlnRuntimeFilterScan(CDXLNode *dxlnode,
+											CColRefSet *pcrsKeys);
+
 	CDXLNode *PdxlnCorrelatedNLJoin(CExpression *pexprNLJ,
 									CColRefArray *colref_array,
 									CDistributionSpecArray *pdrgpdsBaseTables,
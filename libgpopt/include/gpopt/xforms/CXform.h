@@ -219,6 +219,17 @@ public:
 		ExfLeftOuterJoin2DynamicIndexGetApply,
 		ExfLeftOuterJoinWithInnerSelect2DynamicBitmapIndexGetApply,
 		ExfLeftOuterJoinWithInnerSelect2DynamicIndexGetApply,
+		ExfIndexGet2IndexOnlyScan,
+		ExfImplementFullOuterHashJoin,
+		ExfRightOuterJoin2HashJoin,
+		ExfEagerAggNAryJoin,
+		ExfEagerAggLeftOuterJoin,
+		ExfInnerJoinSemiJoinReducer,
+		ExfInnerJoin2MergeJoin,
+		ExfLeftOuterJoin2MergeJoin,
+		ExfPushLimitBelowUnionAll,
+		ExfPushLimitBelowLeftOuterJoin,
+		ExfLeftOuterJoin2RightOuterJoin,
 		ExfInvalid,
 		ExfSentinel = ExfInvalid
 	};
@@ -14,6 +14,7 @@
 
 #include "gpos/base.h"
 #include "gpopt/xforms/CXformExploration.h"
+#include "gpopt/xforms/CXformUtils.h"
 
 namespace gpopt
 {
@@ -58,7 +59,7 @@ public:
 	virtual BOOL
 	FCompatible(CXform::EXformId exfid)
 	{
-		return (CXform::ExfEagerAgg != exfid) &&
+		return !CXformUtils::FEagerAggXform(exfid) &&
 			   (CXform::ExfSplitGbAgg != exfid) &&
 			   (CXform::ExfSplitDQA != exfid);
 	}
@@ -77,6 +78,12 @@ public:
 		return true;
 	};
 
+protected:
+	// index of the join child producing all columns used by the aggregates,
+	// or gpos::ulong_max if there is no such child
+	virtual ULONG PushDownChildIndex(CExpression *join_expr,
+									 CColRefSet *agg_cols) const;
+
 private:
 	// private copy ctor
 	CXformEagerAgg(const CXformEagerAgg &);
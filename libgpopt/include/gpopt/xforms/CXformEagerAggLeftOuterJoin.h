@@ -0,0 +1,68 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformEagerAggLeftOuterJoin.h
+//
+//	@doc:
+//		Eagerly push aggregates below the outer child of a left outer join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformEagerAggLeftOuterJoin_H
+#define GPOPT_CXformEagerAggLeftOuterJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformEagerAgg.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformEagerAggLeftOuterJoin
+//
+//	@doc:
+//		Push a local aggregate below the preserved child of a left outer
+//		join; every outer row is emitted at least once, and all rows of a
+//		lower group share the columns of the join predicate, so they are
+//		emitted equally often
+//
+//---------------------------------------------------------------------------
+class CXformEagerAggLeftOuterJoin : public CXformEagerAgg
+{
+private:
+	// private copy ctor
+	CXformEagerAggLeftOuterJoin(const CXformEagerAggLeftOuterJoin &);
+
+public:
+	// ctor
+	explicit CXformEagerAggLeftOuterJoin(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformEagerAggLeftOuterJoin()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfEagerAggLeftOuterJoin;
+	}
+
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformEagerAggLeftOuterJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+};	// class CXformEagerAggLeftOuterJoin
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformEagerAggLeftOuterJoin_H
+
+// EOF
@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformEagerAggNAryJoin.h
+//
+//	@doc:
+//		Eagerly push aggregates below an n-ary join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformEagerAggNAryJoin_H
+#define GPOPT_CXformEagerAggNAryJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformEagerAgg.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformEagerAggNAryJoin
+//
+//	@doc:
+//		Push a local aggregate below an n-ary join on the child producing
+//		all aggregate inputs, so a chain of inner joins is aggregated before
+//		any of its joins; the child must not be the nullable side of a left
+//		outer join
+//
+//---------------------------------------------------------------------------
+class CXformEagerAggNAryJoin : public CXformEagerAgg
+{
+private:
+	// private copy ctor
+	CXformEagerAggNAryJoin(const CXformEagerAggNAryJoin &);
+
+protected:
+	// index of the join child producing all columns used by the aggregates
+	virtual ULONG PushDownChildIndex(CExpression *join_expr,
+									 CColRefSet *agg_cols) const;
+
+public:
+	// ctor
+	explicit CXformEagerAggNAryJoin(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformEagerAggNAryJoin()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfEagerAggNAryJoin;
+	}
+
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformEagerAggNAryJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+};	// class CXformEagerAggNAryJoin
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformEagerAggNAryJoin_H
+
+// EOF
@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformImplementFullOuterHashJoin.h
+//
+//	@doc:
+//		Transform full outer join to full outer hash join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformImplementFullOuterHashJoin_H
+#define GPOPT_CXformImplementFullOuterHashJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformImplementation.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformImplementFullOuterHashJoin
+//
+//	@doc:
+//		Transform full outer join to full outer hash join
+//
+//---------------------------------------------------------------------------
+class CXformImplementFullOuterHashJoin : public CXformImplementation
+{
+private:
+	// private copy ctor
+	CXformImplementFullOuterHashJoin(const CXformImplementFullOuterHashJoin &);
+
+public:
+	// ctor
+	explicit CXformImplementFullOuterHashJoin(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformImplementFullOuterHashJoin()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfImplementFullOuterHashJoin;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformImplementFullOuterHashJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const;
+
+};	// class CXformImplementFullOuterHashJoin
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformImplementFullOuterHashJoin_H
+
+// EOF
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformInnerJoinSemiJoinReducer.h
+//
+//	@doc:
+//		Reduce the large child of an inner join by a semi join on the
+//		distinct join keys of its small child
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformInnerJoinSemiJoinReducer_H
+#define GPOPT_CXformInnerJoinSemiJoinReducer_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformExploration.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformInnerJoinSemiJoinReducer
+//
+//	@doc:
+//		Transform
+//
+//		InnerJoin
+//		|--Big
+//		+--Small
+//
+//		to
+//
+//		CTEAnchor(Small)
+//		+--InnerJoin
+//		   |--LeftSemiJoin
+//		   |  |--Big
+//		   |  +--Gb(keys(Small))
+//		   |     +--CTEConsumer(Small)
+//		   +--CTEConsumer(Small)
+//
+//		The semi join is a regular logical operator, so the existing swap
+//		xforms push it further down the joins of the big child, where it
+//		filters and partition-eliminates relations that are only indirectly
+//		restricted by the small child
+//
+//---------------------------------------------------------------------------
+class CXformInnerJoinSemiJoinReducer : public CXformExploration
+{
+private:
+	// if ratio of the cardinalities inner/outer is below this value, we
+	// apply the xform
+	static const DOUBLE m_dInnerOuterRatioThreshold;
+
+	// private copy ctor
+	CXformInnerJoinSemiJoinReducer(const CXformInnerJoinSemiJoinReducer &);
+
+	// check if the given join may be reduced
+	static BOOL FReducibleOrigin(CGroupExpression *pgexpr);
+
+	// check the stats ratio to decide whether to apply the xform or not
+	static BOOL FApplyXformUsingStatsInfo(const IStatistics *outer_stats,
+										  const IStatistics *inner_stats);
+
+	// construct the predicate of the semi join from the equality conjuncts
+	// of the join predicate, and collect the inner keys it uses
+	static CExpression *PexprReducerPredicate(
+		CMemoryPool *mp, CExpression *pexprScalar, CColRefSet *pcrsOuter,
+		CColRefSet *pcrsInner, UlongToColRefMap *colref_mapping,
+		CColRefArray **ppdrgpcrKeys);
+
+public:
+	// ctor
+	explicit CXformInnerJoinSemiJoinReducer(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformInnerJoinSemiJoinReducer()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfInnerJoinSemiJoinReducer;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformInnerJoinSemiJoinReducer";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+	// do stats need to be computed before applying xform?
+	virtual BOOL
+	FNeedsStats() const
+	{
+		return true;
+	}
+
+	// actual transform
+	virtual void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+						   CExpression *pexpr) const;
+
+	// return true if xform should be applied only once
+	virtual BOOL
+	IsApplyOnce()
+	{
+		return true;
+	}
+
+};	// class CXformInnerJoinSemiJoinReducer
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformInnerJoinSemiJoinReducer_H
+
+// EOF
@@ -0,0 +1,74 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformLeftOuterJoin2MergeJoin.h
+//
+//	@doc:
+//		Transform left outer join to left outer merge join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformLeftOuterJoin2MergeJoin_H
+#define GPOPT_CXformLeftOuterJoin2MergeJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformImplementation.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformLeftOuterJoin2MergeJoin
+//
+//	@doc:
+//		Transform left outer join to left outer merge join
+//
+//---------------------------------------------------------------------------
+class CXformLeftOuterJoin2MergeJoin : public CXformImplementation
+{
+private:
+	// private copy ctor
+	CXformLeftOuterJoin2MergeJoin(const CXformLeftOuterJoin2MergeJoin &);
+
+
+public:
+	// ctor
+	explicit CXformLeftOuterJoin2MergeJoin(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformLeftOuterJoin2MergeJoin()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfLeftOuterJoin2MergeJoin;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformLeftOuterJoin2MergeJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const;
+
+};	// class CXformLeftOuterJoin2MergeJoin
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformLeftOuterJoin2MergeJoin_H
+
+// EOF
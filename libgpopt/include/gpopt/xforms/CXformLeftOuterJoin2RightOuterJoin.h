@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformLeftOuterJoin2RightOuterJoin.h
+//
+//	@doc:
+//		Transform left outer join to right outer join with swapped children
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformLeftOuterJoin2RightOuterJoin_H
+#define GPOPT_CXformLeftOuterJoin2RightOuterJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformExploration.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformLeftOuterJoin2RightOuterJoin
+//
+//	@doc:
+//		Transform left outer join to right outer join with swapped children
+//
+//---------------------------------------------------------------------------
+class CXformLeftOuterJoin2RightOuterJoin : public CXformExploration
+{
+private:
+	// private copy ctor
+	CXformLeftOuterJoin2RightOuterJoin(
+		const CXformLeftOuterJoin2RightOuterJoin &);
+
+public:
+	// ctor
+	explicit CXformLeftOuterJoin2RightOuterJoin(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformLeftOuterJoin2RightOuterJoin()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfLeftOuterJoin2RightOuterJoin;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformLeftOuterJoin2RightOuterJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const;
+
+};	// class CXformLeftOuterJoin2RightOuterJoin
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformLeftOuterJoin2RightOuterJoin_H
+
+// EOF
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformPushLimitBelowLeftOuterJoin.h
+//
+//	@doc:
+//		Push a limit below the outer child of a left outer join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformPushLimitBelowLeftOuterJoin_H
+#define GPOPT_CXformPushLimitBelowLeftOuterJoin_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformExploration.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformPushLimitBelowLeftOuterJoin
+//
+//	@doc:
+//		Transform
+//
+//		Limit(order, offset, count)
+//		+--LeftOuterJoin
+//		   |--A
+//		   |--B
+//		   +--Predicate
+//
+//		to
+//
+//		Limit(order, offset, count)
+//		+--LeftOuterJoin
+//		   |--Limit(order, 0, offset + count)
+//		   |  +--A
+//		   |--B
+//		   +--Predicate
+//
+//		when the order only uses columns of A; every row of A produces at
+//		least one row of the join, so the first rows of the join come from
+//		the first rows of A
+//
+//---------------------------------------------------------------------------
+class CXformPushLimitBelowLeftOuterJoin : public CXformExploration
+{
+private:
+	// private copy ctor
+	CXformPushLimitBelowLeftOuterJoin(
+		const CXformPushLimitBelowLeftOuterJoin &);
+
+public:
+	// ctor
+	explicit CXformPushLimitBelowLeftOuterJoin(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformPushLimitBelowLeftOuterJoin()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfPushLimitBelowLeftOuterJoin;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformPushLimitBelowLeftOuterJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+	// actual transform
+	virtual void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+						   CExpression *pexpr) const;
+
+};	// class CXformPushLimitBelowLeftOuterJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformPushLimitBelowLeftOuterJoin_H
+
+// EOF
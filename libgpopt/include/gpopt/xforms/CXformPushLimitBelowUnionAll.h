@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformPushLimitBelowUnionAll.h
+//
+//	@doc:
+//		Push a limit below the children of a UnionAll operation
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformPushLimitBelowUnionAll_H
+#define GPOPT_CXformPushLimitBelowUnionAll_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformExploration.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformPushLimitBelowUnionAll
+//
+//	@doc:
+//		Transform
+//
+//		Limit(order, offset, count)
+//		+--UnionAll
+//		   |--A
+//		   +--B
+//
+//		to
+//
+//		Limit(order, offset, count)
+//		+--UnionAll
+//		   |--Limit(order, 0, offset + count)
+//		   |  +--A
+//		   +--Limit(order, 0, offset + count)
+//		      +--B
+//
+//		Each new limit is split into local and global limits, so every
+//		segment sends at most offset + count rows of each child to the
+//		global limit
+//
+//---------------------------------------------------------------------------
+class CXformPushLimitBelowUnionAll : public CXformExploration
+{
+private:
+	// private copy ctor
+	CXformPushLimitBelowUnionAll(const CXformPushLimitBelowUnionAll &);
+
+public:
+	// ctor
+	explicit CXformPushLimitBelowUnionAll(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformPushLimitBelowUnionAll()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfPushLimitBelowUnionAll;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformPushLimitBelowUnionAll";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+	// actual transform
+	virtual void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+						   CExpression *pexpr) const;
+
+};	// class CXformPushLimitBelowUnionAll
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformPushLimitBelowUnionAll_H
+
+// EOF
@@ -14,6 +14,7 @@
 
 #include "gpos/base.h"
 #include "gpopt/xforms/CXformExploration.h"
+#include "gpopt/xforms/CXformUtils.h"
 
 namespace gpopt
 {
@@ -68,7 +69,7 @@ public:
 		return (CXform::ExfSimplifyGbAgg != exfid) &&
 			   (CXform::ExfSplitDQA != exfid) &&
 			   (CXform::ExfSplitGbAgg != exfid) &&
-			   (CXform::ExfEagerAgg != exfid);
+			   !CXformUtils::FEagerAggXform(exfid);
 	}
 
 	// compute xform promise for a given expression handle
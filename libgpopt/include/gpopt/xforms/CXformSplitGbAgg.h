@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpopt/xforms/CXformExploration.h"
+#include "gpopt/xforms/CXformUtils.h"
 
 namespace gpopt
 {
@@ -80,7 +81,7 @@ public:
 	{
 		return ((CXform::ExfSplitDQA != exfid) &&
 				(CXform::ExfSplitGbAgg != exfid) &&
-				(CXform::ExfEagerAgg != exfid));
+				!CXformUtils::FEagerAggXform(exfid));
 	}
 
 	// compute xform promise for a given expression handle
@@ -0,0 +1,156 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformStats.h
+//
+//	@doc:
+//		Process-wide statistics on the yield of xforms
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformStats_H
+#define GPOPT_CXformStats_H
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXform.h"
+
+// number of group expression arities xform statistics are kept for; the
+// last bucket covers all larger arities
+#define GPOPT_XFORM_STATS_ARITIES 8
+
+// factor applied to all statistics whenever a new query of the same session
+// starts recording
+#define GPOPT_XFORM_STATS_DECAY 0.98
+
+// decayed number of calls needed before the yield of an xform is trusted
+#define GPOPT_XFORM_STATS_MIN_CALLS 100.0
+
+// yield, in results per call, below which an xform may be skipped
+#define GPOPT_XFORM_STATS_MIN_YIELD 0.01
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformStats
+//
+//	@doc:
+//		Number of calls and results of each xform, kept across the queries
+//		of a session and broken down by the arity of the group expression
+//		the xform was applied to. Older queries weigh less, as all
+//		statistics decay whenever a new query of the session starts
+//		recording; they are forgotten when a query of another session
+//		starts, and before a minidump is replayed, so that the plan of a
+//		query never depends on the queries other sessions optimized before.
+//
+//		The yield of an xform, in results per call, is used to order
+//		transformation jobs, and to skip exploration xforms that almost
+//		never produce results on expressions of the same shape. Skipping
+//		is a heuristic: an exploration xform that rarely produces results
+//		may still produce the only alternative that satisfies a required
+//		property, e.g. the commuted join that delivers a requested
+//		distribution or order. The search then settles for a plan with
+//		more enforcers, or finds no plan at all, which is why skipping is
+//		limited to large queries and kept behind a trace flag that is off
+//		by default.
+//
+//		Queries of a process are optimized one at a time, so the
+//		statistics are not synchronized.
+//
+//---------------------------------------------------------------------------
+class CXformStats
+{
+private:
+	// decayed number of calls
+	DOUBLE m_rgdCalls[CXform::ExfSentinel][GPOPT_XFORM_STATS_ARITIES];
+
+	// decayed number of results
+	DOUBLE m_rgdResults[CXform::ExfSentinel][GPOPT_XFORM_STATS_ARITIES];
+
+	// session of the last query that started recording
+	ULONG m_ulSessionId;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// global instance
+	static CXformStats *m_pxfstats;
+
+	// private ctor
+	explicit CXformStats(CMemoryPool *mp);
+
+	// private copy ctor
+	CXformStats(const CXformStats &);
+
+	// bucket of the given arity
+	static ULONG
+	UlBucket(ULONG arity)
+	{
+		return std::min(arity, (ULONG) GPOPT_XFORM_STATS_ARITIES - 1);
+	}
+
+public:
+	// forget all statistics
+	void Reset();
+
+	// decay all statistics before a new query records its own
+	void Decay();
+
+	// prepare for a new query of the given session: decay the statistics
+	// of earlier queries of the same session, forget those of other
+	// sessions
+	void StartQuery(ULONG ulSessionId);
+
+	// record a call of an xform and the number of results it produced
+	void
+	Record(CXform::EXformId exfid, ULONG arity, ULONG ulResults)
+	{
+		ULONG ulBucket = UlBucket(arity);
+		m_rgdCalls[exfid][ulBucket] += 1.0;
+		m_rgdResults[exfid][ulBucket] += ulResults;
+	}
+
+	// decayed number of calls of an xform
+	DOUBLE
+	DCalls(CXform::EXformId exfid, ULONG arity) const
+	{
+		return m_rgdCalls[exfid][UlBucket(arity)];
+	}
+
+	// yield of an xform in results per call; xforms never called are
+	// assumed to always produce a result
+	DOUBLE DYield(CXform::EXformId exfid, ULONG arity) const;
+
+	// check if an xform rarely produced results on similar expressions
+	BOOL FUnproductive(CXform::EXformId exfid, ULONG arity) const;
+
+	// fill the given array with the xforms of the set, sorted by ascending
+	// yield, leaving out unproductive exploration xforms if requested;
+	// return the number of xforms in the array
+	ULONG UlSortByYield(CXformSet *xform_set, ULONG arity,
+						BOOL fSkipUnproductive,
+						CXform::EXformId *rgexfid) const;
+
+	// global accessor
+	static CXformStats *
+	Pxfstats()
+	{
+		return m_pxfstats;
+	}
+
+	// initialize global instance
+	static GPOS_RESULT Init();
+
+	// destroy global instance
+	void Shutdown();
+
+};	// class CXformStats
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformStats_H
+
+// EOF
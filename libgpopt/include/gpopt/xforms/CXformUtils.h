@@ -545,6 +545,13 @@ public:
 	static CExpression *PexprAssertOneRow(CMemoryPool *mp,
 										  CExpression *pexprChild);
 
+	// create a limit on the given child of the relational child of a limit
+	// expression, keeping every row the limit may return
+	static CExpression *PexprLimitBelow(CMemoryPool *mp,
+										CExpression *pexprLimit,
+										CExpression *pexprChild,
+										UlongToColRefMap *colref_mapping);
+
 	// helper for adding CTE producer to global CTE info structure
 	static CExpression *PexprAddCTEProducer(CMemoryPool *mp, ULONG ulCTEId,
 											CColRefArray *colref_array,
@@ -688,6 +695,9 @@ public:
 	// check if given xform is an Agg splitting xform
 	static BOOL FSplitAggXform(CXform::EXformId exfid);
 
+	// check if given xform pushes a local Agg below a join
+	static BOOL FEagerAggXform(CXform::EXformId exfid);
+
 	// check if given xform is an Agg CXformSplitDQA
 	static BOOL FAggGenBySplitDQAXform(CExpression *pexprAgg);
 
@@ -924,41 +934,20 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 	}
 
 	CMemoryPool *mp = pxfctxt->Pmp();
-	CExpressionArray *pdrgpexprOuter = NULL;
-	CExpressionArray *pdrgpexprInner = NULL;
-
-	// check if we have already computed join keys for the scalar child
-	LookupJoinKeys(mp, pexpr, &pdrgpexprOuter, &pdrgpexprInner);
-	if (NULL != pdrgpexprOuter)
-	{
-		GPOS_ASSERT(NULL != pdrgpexprInner);
-		if (0 == pdrgpexprOuter->Size())
-		{
-			GPOS_ASSERT(0 == pdrgpexprInner->Size());
-
-			// we failed before to find join keys for scalar child,
-			// no reason to try to do the same again
-			pdrgpexprOuter->Release();
-			pdrgpexprInner->Release();
-		}
-		else
-		{
-			// we have computed join keys on scalar child before, reuse them
-			AddHashOrMergeJoinAlternative<T>(mp, pexpr, pdrgpexprOuter,
-											 pdrgpexprInner, pxfres);
-		}
-
-		return;
-	}
-
 	CExpression *pexprOuter = (*pexpr)[0];
 	CExpression *pexprInner = (*pexpr)[1];
 	CExpression *pexprScalar = (*pexpr)[2];
 
+	// inner and left outer merge joins evaluate the conjuncts that are not
+	// merge joinable as a join filter
+	const BOOL fFullJoin =
+		COperator::EopLogicalFullOuterJoin == pexpr->Pop()->Eopid();
+
 	// split the predicate into arrays of conjuncts based on if they are
-	// output from inner or outer child
-	pdrgpexprOuter = GPOS_NEW(mp) CExpressionArray(mp);
-	pdrgpexprInner = GPOS_NEW(mp) CExpressionArray(mp);
+	// output from inner or outer child; the join keys cached on the scalar
+	// child are hash join keys, which need not be merge joinable
+	CExpressionArray *pdrgpexprOuter = GPOS_NEW(mp) CExpressionArray(mp);
+	CExpressionArray *pdrgpexprInner = GPOS_NEW(mp) CExpressionArray(mp);
 
 	CExpressionArray *pdrgpexpr =
 		CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
@@ -981,7 +970,7 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 			pdrgpexprOuter->Append(pexprPredOuter);
 			pdrgpexprInner->Append(pexprPredInner);
 		}
-		else
+		else if (fFullJoin)
 		{
 			// In case of FULL merge joins, all the merge clauses must be merge
 			// compatible or we cannot create a merge join.
@@ -1001,9 +990,6 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 		CExpression(mp, pexpr->Pop(), pexprOuter, pexprInner,
 					CPredicateUtils::PexprConjunction(mp, pdrgpexpr));
 
-	// cache hash join keys on scalar child group
-	CacheJoinKeys(pexprResult, pdrgpexprOuter, pdrgpexprInner);
-
 	// Add an alternative only if we found at least one merge-joinable predicate
 	if (0 != pdrgpexprOuter->Size())
 	{
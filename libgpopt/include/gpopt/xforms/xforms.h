@@ -29,6 +29,7 @@
 #include "gpopt/xforms/CXformImplementTVF.h"
 #include "gpopt/xforms/CXformImplementTVFNoArgs.h"
 #include "gpopt/xforms/CXformIndexGet2IndexScan.h"
+#include "gpopt/xforms/CXformIndexGet2IndexOnlyScan.h"
 #include "gpopt/xforms/CXformImplementBitmapTableGet.h"
 #include "gpopt/xforms/CXformImplementDynamicBitmapTableGet.h"
 #include "gpopt/xforms/CXformImplementUnionAll.h"
@@ -50,10 +51,14 @@
 #include "gpopt/xforms/CXformInnerJoin2NLJoin.h"
 #include "gpopt/xforms/CXformImplementIndexApply.h"
 #include "gpopt/xforms/CXformInnerJoin2HashJoin.h"
+#include "gpopt/xforms/CXformInnerJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformPushDownLeftOuterJoin.h"
 #include "gpopt/xforms/CXformSimplifyLeftOuterJoin.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2HashJoin.h"
+#include "gpopt/xforms/CXformLeftOuterJoin2RightOuterJoin.h"
+#include "gpopt/xforms/CXformRightOuterJoin2HashJoin.h"
+#include "gpopt/xforms/CXformLeftOuterJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformLeftSemiJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLeftSemiJoin2HashJoin.h"
 #include "gpopt/xforms/CXformLeftAntiSemiJoin2CrossProduct.h"
@@ -84,6 +89,7 @@
 #include "gpopt/xforms/CXformAntiSemiJoinNotInSemiJoinSwap.h"
 #include "gpopt/xforms/CXformAntiSemiJoinNotInInnerJoinSwap.h"
 #include "gpopt/xforms/CXformInnerJoinSemiJoinSwap.h"
+#include "gpopt/xforms/CXformInnerJoinSemiJoinReducer.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinSwap.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinNotInSwap.h"
 #include "gpopt/xforms/CXformLeftSemiJoin2InnerJoin.h"
@@ -161,6 +167,7 @@
 #include "gpopt/xforms/CXformImplementSequenceProject.h"
 #include "gpopt/xforms/CXformExpandFullOuterJoin.h"
 #include "gpopt/xforms/CXformImplementFullOuterMergeJoin.h"
+#include "gpopt/xforms/CXformImplementFullOuterHashJoin.h"
 #include "gpopt/xforms/CXformLeftOuter2InnerUnionAllLeftAntiSemiJoin.h"
 #include "gpopt/xforms/CXformCollapseProject.h"
 #include "gpopt/xforms/CXformSplitLimit.h"
@@ -171,10 +178,14 @@
 #include "gpopt/xforms/CXformCollapseGbAgg.h"
 #include "gpopt/xforms/CXformPushGbBelowJoin.h"
 #include "gpopt/xforms/CXformEagerAgg.h"
+#include "gpopt/xforms/CXformEagerAggNAryJoin.h"
+#include "gpopt/xforms/CXformEagerAggLeftOuterJoin.h"
 #include "gpopt/xforms/CXformPushGbDedupBelowJoin.h"
 #include "gpopt/xforms/CXformPushGbWithHavingBelowJoin.h"
 #include "gpopt/xforms/CXformPushGbBelowUnion.h"
 #include "gpopt/xforms/CXformPushGbBelowUnionAll.h"
+#include "gpopt/xforms/CXformPushLimitBelowUnionAll.h"
+#include "gpopt/xforms/CXformPushLimitBelowLeftOuterJoin.h"
 #include "gpopt/xforms/CXformGbAggWithMDQA2Join.h"
 #include "gpopt/xforms/CXformMaxOneRow2Assert.h"
 #include "gpopt/xforms/CXformRemoveSubqDistinct.h"
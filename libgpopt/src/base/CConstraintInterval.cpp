@@ -267,6 +267,12 @@ CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(CMemoryPool *mp,
 		}
 		case IMDType::EcmptNEq:
 		{
+			if (0 == apdatumsortedset->Size())
+			{
+				// array consists of nulls only, NOT IN is never true
+				break;
+			}
+
 			// NOT IN case, create ranges: (-inf, X) (X, Y) (Y, Z) (Z, inf)
 			IDatum *pprevdatum = NULL;
 			IDatum *datum = NULL;
@@ -1047,6 +1053,14 @@ CConstraintInterval::PciIntersect(CMemoryPool *mp, CConstraintInterval *pci)
 
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
+	if (FNativePoints(pci))
+	{
+		return GPOS_NEW(mp) CConstraintInterval(
+			mp, m_pcr,
+			PdrgprngIntersectNativePoints(mp, m_pdrgprng, pdrgprngOther),
+			m_fIncludesNull && pci->FIncludesNull());
+	}
+
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
 
 	ULONG ulFst = 0;
@@ -1096,6 +1110,13 @@ CConstraintInterval::PciUnion(CMemoryPool *mp, CConstraintInterval *pci)
 
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
+	if (FNativePoints(pci))
+	{
+		return GPOS_NEW(mp) CConstraintInterval(
+			mp, m_pcr, PdrgprngUnionNativePoints(mp, m_pdrgprng, pdrgprngOther),
+			m_fIncludesNull || pci->FIncludesNull());
+	}
+
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
 
 	ULONG ulFst = 0;
@@ -1145,6 +1166,14 @@ CConstraintInterval::PciDifference(CMemoryPool *mp, CConstraintInterval *pci)
 
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
+	if (FNativePoints(pci))
+	{
+		return GPOS_NEW(mp) CConstraintInterval(
+			mp, m_pcr,
+			PdrgprngDifferenceNativePoints(mp, m_pdrgprng, pdrgprngOther),
+			m_fIncludesNull && !pci->FIncludesNull());
+	}
+
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
 
 	ULONG ulFst = 0;
@@ -1306,6 +1335,192 @@ CConstraintInterval::MdidType()
 	return m_pcr->RetrieveType()->MDId();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::FNativePoints
+//
+//	@doc:
+//		Do this interval and the given one consist only of points whose
+//		native keys belong to the same domain. Such intervals, typically
+//		built from IN lists or OR-ed equality predicates, are merged as
+//		sorted arrays of 64-bit keys without going through the comparator
+//
+//---------------------------------------------------------------------------
+BOOL
+CConstraintInterval::FNativePoints(CConstraintInterval *pci) const
+{
+	CRangeArray *pdrgprngOther = pci->Pdrgprng();
+	if (0 == m_pdrgprng->Size() || 0 == pdrgprngOther->Size())
+	{
+		return false;
+	}
+
+	const CRange::ENativeKey enk = (*m_pdrgprng)[0]->Enk();
+	if (CRange::EnkNone == enk)
+	{
+		return false;
+	}
+
+	CRangeArray *rgpdrgprng[] = {m_pdrgprng, pdrgprngOther};
+	for (ULONG ulArr = 0; ulArr < GPOS_ARRAY_SIZE(rgpdrgprng); ulArr++)
+	{
+		CRangeArray *pdrgprng = rgpdrgprng[ulArr];
+		const ULONG length = pdrgprng->Size();
+		for (ULONG ul = 0; ul < length; ul++)
+		{
+			CRange *prange = (*pdrgprng)[ul];
+			if (enk != prange->Enk() || !prange->FPoint())
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PdrgprngUnionNativePoints
+//
+//	@doc:
+//		Union of two sorted arrays of points with native keys
+//
+//---------------------------------------------------------------------------
+CRangeArray *
+CConstraintInterval::PdrgprngUnionNativePoints(CMemoryPool *mp,
+											   CRangeArray *pdrgprngFst,
+											   CRangeArray *pdrgprngSnd)
+{
+	const ULONG ulNumRangesFst = pdrgprngFst->Size();
+	const ULONG ulNumRangesSnd = pdrgprngSnd->Size();
+	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
+
+	ULONG ulFst = 0;
+	ULONG ulSnd = 0;
+	while (ulFst < ulNumRangesFst && ulSnd < ulNumRangesSnd)
+	{
+		CRange *prangeFst = (*pdrgprngFst)[ulFst];
+		CRange *prangeSnd = (*pdrgprngSnd)[ulSnd];
+		const LINT lFst = prangeFst->LNativeLeft();
+		const LINT lSnd = prangeSnd->LNativeLeft();
+
+		CRange *prange = prangeFst;
+		if (lFst <= lSnd)
+		{
+			// a point present on both sides is only added once
+			ulSnd += (lFst == lSnd);
+			ulFst++;
+		}
+		else
+		{
+			prange = prangeSnd;
+			ulSnd++;
+		}
+
+		prange->AddRef();
+		pdrgprngNew->Append(prange);
+	}
+
+	CRangeArray *pdrgprngRemaining = pdrgprngFst;
+	ULONG ulRemaining = ulFst;
+	if (ulSnd < ulNumRangesSnd)
+	{
+		pdrgprngRemaining = pdrgprngSnd;
+		ulRemaining = ulSnd;
+	}
+
+	const ULONG length = pdrgprngRemaining->Size();
+	for (ULONG ul = ulRemaining; ul < length; ul++)
+	{
+		CRange *prange = (*pdrgprngRemaining)[ul];
+		prange->AddRef();
+		pdrgprngNew->Append(prange);
+	}
+
+	return pdrgprngNew;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PdrgprngIntersectNativePoints
+//
+//	@doc:
+//		Intersection of two sorted arrays of points with native keys
+//
+//---------------------------------------------------------------------------
+CRangeArray *
+CConstraintInterval::PdrgprngIntersectNativePoints(CMemoryPool *mp,
+												   CRangeArray *pdrgprngFst,
+												   CRangeArray *pdrgprngSnd)
+{
+	const ULONG ulNumRangesFst = pdrgprngFst->Size();
+	const ULONG ulNumRangesSnd = pdrgprngSnd->Size();
+	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
+
+	ULONG ulFst = 0;
+	ULONG ulSnd = 0;
+	while (ulFst < ulNumRangesFst && ulSnd < ulNumRangesSnd)
+	{
+		CRange *prangeFst = (*pdrgprngFst)[ulFst];
+		const LINT lFst = prangeFst->LNativeLeft();
+		const LINT lSnd = (*pdrgprngSnd)[ulSnd]->LNativeLeft();
+
+		if (lFst == lSnd)
+		{
+			prangeFst->AddRef();
+			pdrgprngNew->Append(prangeFst);
+		}
+
+		ulFst += (lFst <= lSnd);
+		ulSnd += (lSnd <= lFst);
+	}
+
+	return pdrgprngNew;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PdrgprngDifferenceNativePoints
+//
+//	@doc:
+//		Difference of two sorted arrays of points with native keys
+//
+//---------------------------------------------------------------------------
+CRangeArray *
+CConstraintInterval::PdrgprngDifferenceNativePoints(CMemoryPool *mp,
+													CRangeArray *pdrgprngFst,
+													CRangeArray *pdrgprngSnd)
+{
+	const ULONG ulNumRangesFst = pdrgprngFst->Size();
+	const ULONG ulNumRangesSnd = pdrgprngSnd->Size();
+	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
+
+	ULONG ulSnd = 0;
+	for (ULONG ulFst = 0; ulFst < ulNumRangesFst; ulFst++)
+	{
+		CRange *prangeFst = (*pdrgprngFst)[ulFst];
+		const LINT lFst = prangeFst->LNativeLeft();
+
+		while (ulSnd < ulNumRangesSnd &&
+			   (*pdrgprngSnd)[ulSnd]->LNativeLeft() < lFst)
+		{
+			ulSnd++;
+		}
+
+		if (ulSnd < ulNumRangesSnd &&
+			(*pdrgprngSnd)[ulSnd]->LNativeLeft() == lFst)
+		{
+			continue;
+		}
+
+		prangeFst->AddRef();
+		pdrgprngNew->Append(prangeFst);
+	}
+
+	return pdrgprngNew;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintInterval::PciComplement
@@ -324,7 +324,8 @@ CCostContext::BreakCostTiesForJoinPlans(
 	GPOS_ASSERT(NULL != pccSnd);
 	GPOS_ASSERT(NULL != ppccPrefered);
 	GPOS_ASSERT(NULL != pfTiesResolved);
-	GPOS_ASSERT(*(pccFst->Poc()) == *(pccSnd->Poc()));
+	GPOS_ASSERT(pccFst->Poc()->Pgroup() == pccSnd->Poc()->Pgroup());
+	GPOS_ASSERT(pccFst->Poc()->Prpp()->Equals(pccSnd->Poc()->Prpp()));
 	GPOS_ASSERT(estCosted == pccFst->Est());
 	GPOS_ASSERT(estCosted == pccSnd->Est());
 	GPOS_ASSERT(pccFst->Cost() == pccSnd->Cost());
@@ -391,14 +392,16 @@ CCostContext::BreakCostTiesForJoinPlans(
 //
 //	@doc:
 //		Is current context better than the given equivalent context
-//		based on cost?
+//		based on cost? The contexts may belong to different search stages,
+//		e.g. when looking up the best context across all stages
 //
 //---------------------------------------------------------------------------
 BOOL
 CCostContext::FBetterThan(const CCostContext *pcc) const
 {
 	GPOS_ASSERT(NULL != pcc);
-	GPOS_ASSERT(*m_poc == *(pcc->Poc()));
+	GPOS_ASSERT(m_poc->Pgroup() == pcc->Poc()->Pgroup());
+	GPOS_ASSERT(m_poc->Prpp()->Equals(pcc->Poc()->Prpp()));
 	GPOS_ASSERT(estCosted == m_estate);
 	GPOS_ASSERT(estCosted == pcc->Est());
 
@@ -3,12 +3,31 @@
 
 #include "gpopt/operators/COperator.h"
 #include "gpopt/base/CDatumSortedSet.h"
+#include "gpopt/base/CRange.h"
 #include "gpopt/operators/CScalarConst.h"
 #include "gpopt/base/CUtils.h"
 #include "gpos/common/CAutoRef.h"
+#include "gpos/common/clibwrapper.h"
 
 using namespace gpopt;
 
+// a datum along with its native key
+struct SNativeDatum
+{
+	LINT m_lKey;
+	IDatum *m_pdatum;
+
+	// compares two native datums by their keys
+	static INT
+	ICmp(const void *val1, const void *val2)
+	{
+		const SNativeDatum *pnd1 = static_cast<const SNativeDatum *>(val1);
+		const SNativeDatum *pnd2 = static_cast<const SNativeDatum *>(val2);
+
+		return CUtils::ILintCmp(&pnd1->m_lKey, &pnd2->m_lKey);
+	}
+};
+
 CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 								 const IComparator *pcomp)
 	: IDatumArray(mp), m_fIncludesNull(false)
@@ -19,6 +38,8 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 	GPOS_ASSERT(0 < ulArrayExprArity);
 
 	gpos::CAutoRef<IDatumArray> aprngdatum(GPOS_NEW(mp) IDatumArray(mp));
+	CRange::ENativeKey enk = CRange::EnkNone;
+	BOOL fNative = true;
 	for (ULONG ul = 0; ul < ulArrayExprArity; ul++)
 	{
 		CScalarConst *popScConst =
@@ -30,22 +51,81 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 		}
 		else
 		{
+			// all datums must have native keys of the same domain to be
+			// sorted without the comparator
+			CRange::ENativeKey enkDatum = CRange::EnkDatum(datum);
+			fNative = fNative && CRange::EnkNone != enkDatum &&
+					  (0 == aprngdatum->Size() || enk == enkDatum);
+			enk = enkDatum;
+
 			datum->AddRef();
 			aprngdatum->Append(datum);
 		}
 	}
-	aprngdatum->Sort(&CUtils::IDatumCmp);
+
+	if (0 == aprngdatum->Size())
+	{
+		// array consists of nulls only
+		return;
+	}
+
+	if (fNative)
+	{
+		SortNative(mp, aprngdatum.Value());
+	}
+	else
+	{
+		SortGeneric(aprngdatum.Value(), pcomp);
+	}
+}
+
+// sort and de-duplicate datums whose native keys belong to the same domain;
+// large IN lists of integers, oids, dates and timestamps are sorted in a
+// single pass over an array of 64-bit keys instead of calling the comparator
+// O(n log n) times
+void
+CDatumSortedSet::SortNative(CMemoryPool *mp, IDatumArray *pdrgpdatum)
+{
+	const ULONG length = pdrgpdatum->Size();
+	SNativeDatum *rgnd = GPOS_NEW_ARRAY(mp, SNativeDatum, length);
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		IDatum *datum = (*pdrgpdatum)[ul];
+		rgnd[ul].m_lKey = CRange::LNativeKey(datum);
+		rgnd[ul].m_pdatum = datum;
+	}
+
+	clib::Qsort(rgnd, length, sizeof(SNativeDatum), SNativeDatum::ICmp);
+
+	// de-duplicate
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		if (0 == ul || rgnd[ul].m_lKey != rgnd[ul - 1].m_lKey)
+		{
+			rgnd[ul].m_pdatum->AddRef();
+			Append(rgnd[ul].m_pdatum);
+		}
+	}
+
+	GPOS_DELETE_ARRAY(rgnd);
+}
+
+// sort and de-duplicate datums using the comparator
+void
+CDatumSortedSet::SortGeneric(IDatumArray *pdrgpdatum, const IComparator *pcomp)
+{
+	pdrgpdatum->Sort(&CUtils::IDatumCmp);
 
 	// de-duplicate
-	const ULONG ulRangeArrayArity = aprngdatum->Size();
-	IDatum *pdatumPrev = (*aprngdatum)[0];
+	const ULONG ulRangeArrayArity = pdrgpdatum->Size();
+	IDatum *pdatumPrev = (*pdrgpdatum)[0];
 	pdatumPrev->AddRef();
 	Append(pdatumPrev);
 	for (ULONG ul = 1; ul < ulRangeArrayArity; ul++)
 	{
-		if (!pcomp->Equals((*aprngdatum)[ul], pdatumPrev))
+		if (!pcomp->Equals((*pdrgpdatum)[ul], pdatumPrev))
 		{
-			pdatumPrev = (*aprngdatum)[ul];
+			pdatumPrev = (*pdrgpdatum)[ul];
 			pdatumPrev->AddRef();
 			Append(pdatumPrev);
 		}
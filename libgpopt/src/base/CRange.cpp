@@ -10,12 +10,14 @@
 //---------------------------------------------------------------------------
 
 #include "gpos/base.h"
+#include "gpos/common/clibwrapper.h"
 
 #include "gpopt/base/CRange.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/base/IComparator.h"
 #include "gpopt/operators/CPredicateUtils.h"
 
+#include "naucrates/md/CMDIdGPDB.h"
 #include "naucrates/md/IMDScalarOp.h"
 
 using namespace gpopt;
@@ -37,13 +39,18 @@ CRange::CRange(IMDId *mdid, const IComparator *pcomp, IDatum *pdatumLeft,
 	  m_pdatumLeft(pdatumLeft),
 	  m_eriLeft(eriLeft),
 	  m_pdatumRight(pdatumRight),
-	  m_eriRight(eriRight)
+	  m_eriRight(eriRight),
+	  m_enk(EnkNone),
+	  m_lLeft(0),
+	  m_lRight(0)
 {
 	GPOS_ASSERT(mdid->IsValid());
 	GPOS_ASSERT(NULL != pcomp);
 	GPOS_ASSERT(CUtils::FConstrainableType(mdid));
 	GPOS_ASSERT_IMP(NULL != pdatumLeft && NULL != pdatumRight,
 					pcomp->IsLessThanOrEqual(pdatumLeft, pdatumRight));
+
+	InitNativeKeys();
 }
 
 //---------------------------------------------------------------------------
@@ -62,7 +69,10 @@ CRange::CRange(const IComparator *pcomp, IMDType::ECmpType cmp_type,
 	  m_pdatumLeft(NULL),
 	  m_eriLeft(EriExcluded),
 	  m_pdatumRight(NULL),
-	  m_eriRight(EriExcluded)
+	  m_eriRight(EriExcluded),
+	  m_enk(EnkNone),
+	  m_lLeft(0),
+	  m_lRight(0)
 {
 	m_mdid = datum->MDId();
 
@@ -113,6 +123,8 @@ CRange::CRange(const IComparator *pcomp, IMDType::ECmpType cmp_type,
 			// for anything else, create a (-inf, inf) range
 			break;
 	}
+
+	InitNativeKeys();
 }
 
 //---------------------------------------------------------------------------
@@ -130,6 +142,192 @@ CRange::~CRange()
 	CRefCount::SafeRelease(m_pdatumRight);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CRange::EnkDatum
+//
+//	@doc:
+//		Native key domain of a datum. Only types whose native key preserves
+//		the order of the type's comparison operators have a native domain
+//
+//---------------------------------------------------------------------------
+CRange::ENativeKey
+CRange::EnkDatum(IDatum *datum)
+{
+	GPOS_ASSERT(NULL != datum);
+
+	if (datum->IsNull())
+	{
+		return EnkNone;
+	}
+
+	switch (datum->GetDatumType())
+	{
+		case IMDType::EtiInt2:
+		case IMDType::EtiInt4:
+		case IMDType::EtiInt8:
+			return EnkInt;
+
+		case IMDType::EtiOid:
+			return EnkOid;
+
+		case IMDType::EtiBool:
+			return EnkBool;
+
+		case IMDType::EtiGeneric:
+		{
+			// date and timestamps are keyed by their internal representation,
+			// so make sure it has the expected width
+			IMDId *mdid = datum->MDId();
+			if (CMDIdGPDB::m_mdid_date.Equals(mdid))
+			{
+				return sizeof(INT) == datum->Size() ? EnkDate : EnkNone;
+			}
+			if (CMDIdGPDB::m_mdid_timestamp.Equals(mdid))
+			{
+				return sizeof(LINT) == datum->Size() ? EnkTimestamp : EnkNone;
+			}
+			if (CMDIdGPDB::m_mdid_timestampTz.Equals(mdid))
+			{
+				return sizeof(LINT) == datum->Size() ? EnkTimestampTz
+													 : EnkNone;
+			}
+			return EnkNone;
+		}
+
+		default:
+			return EnkNone;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CRange::LNativeKey
+//
+//	@doc:
+//		Native key of a datum. Integers, oids and booleans use their LINT
+//		mapping. Generic datums are not mappable to LINT, and their stats
+//		double mapping is not exact, so dates (days) and timestamps
+//		(microseconds) are read from their internal representation
+//
+//---------------------------------------------------------------------------
+LINT
+CRange::LNativeKey(IDatum *datum)
+{
+	GPOS_ASSERT(NULL != datum);
+
+	switch (EnkDatum(datum))
+	{
+		case EnkDate:
+		{
+			INT iDays = 0;
+			(void) clib::Memcpy(&iDays, datum->GetByteArrayValue(),
+								sizeof(iDays));
+			return LINT(iDays);
+		}
+
+		case EnkTimestamp:
+		case EnkTimestampTz:
+		{
+			LINT lMicroSecs = 0;
+			(void) clib::Memcpy(&lMicroSecs, datum->GetByteArrayValue(),
+								sizeof(lMicroSecs));
+			return lMicroSecs;
+		}
+
+		default:
+			GPOS_ASSERT(EnkNone != EnkDatum(datum));
+			return datum->GetLINTMapping();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CRange::InitNativeKeys
+//
+//	@doc:
+//		Cache the native keys of the bounded end points. A range gets a
+//		native key domain only if all of its bounded end points belong to
+//		the same domain; fully unbounded ranges have none, as they are never
+//		compared by end point value
+//
+//---------------------------------------------------------------------------
+void
+CRange::InitNativeKeys()
+{
+	ENativeKey enkLeft = EnkNone;
+	ENativeKey enkRight = EnkNone;
+
+	if (NULL != m_pdatumLeft)
+	{
+		enkLeft = EnkDatum(m_pdatumLeft);
+		if (EnkNone == enkLeft)
+		{
+			return;
+		}
+	}
+
+	if (NULL != m_pdatumRight)
+	{
+		enkRight = EnkDatum(m_pdatumRight);
+		if (EnkNone == enkRight)
+		{
+			return;
+		}
+	}
+
+	if (NULL != m_pdatumLeft && NULL != m_pdatumRight && enkLeft != enkRight)
+	{
+		return;
+	}
+
+	if (NULL != m_pdatumLeft)
+	{
+		m_enk = enkLeft;
+		m_lLeft = LNativeKey(m_pdatumLeft);
+	}
+
+	if (NULL != m_pdatumRight)
+	{
+		m_enk = enkRight;
+		m_lRight = LNativeKey(m_pdatumRight);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CRange::ICompare
+//
+//	@doc:
+//		Three-way comparison of two bounded end points, using their native
+//		keys if possible and the comparator otherwise
+//
+//---------------------------------------------------------------------------
+INT
+CRange::ICompare(const IDatum *pdatumFst, LINT lFst, const IDatum *pdatumSnd,
+				 LINT lSnd, BOOL fNative) const
+{
+	GPOS_ASSERT(NULL != pdatumFst);
+	GPOS_ASSERT(NULL != pdatumSnd);
+
+	if (fNative)
+	{
+		return (lFst > lSnd) - (lFst < lSnd);
+	}
+
+	if (m_pcomp->IsLessThan(pdatumFst, pdatumSnd))
+	{
+		return -1;
+	}
+
+	if (m_pcomp->Equals(pdatumFst, pdatumSnd))
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CRange::FDisjointLeft
@@ -150,12 +348,14 @@ CRange::FDisjointLeft(CRange *prange)
 		return false;
 	}
 
-	if (m_pcomp->IsLessThan(m_pdatumRight, pdatumLeft))
+	INT iCmp = ICompare(m_pdatumRight, m_lRight, pdatumLeft, prange->m_lLeft,
+						FNativeComparable(prange));
+	if (0 > iCmp)
 	{
 		return true;
 	}
 
-	if (m_pcomp->Equals(m_pdatumRight, pdatumLeft))
+	if (0 == iCmp)
 	{
 		return (EriExcluded == m_eriRight || EriExcluded == prange->EriLeft());
 	}
@@ -242,6 +442,11 @@ CRange::FUpperBoundEqualsLowerBound(CRange *prange)
 		return false;
 	}
 
+	if (FNativeComparable(prange))
+	{
+		return m_lRight == prange->m_lLeft;
+	}
+
 	return m_pcomp->Equals(m_pdatumRight, pdatumLeft);
 }
 
@@ -272,8 +477,17 @@ CRange::FStartsWithOrBefore(CRange *prange)
 		return false;
 	}
 
-	return (m_pcomp->Equals(m_pdatumLeft, pdatumLeft) &&
-			m_eriLeft == prange->EriLeft());
+	if (m_eriLeft != prange->EriLeft())
+	{
+		return false;
+	}
+
+	if (FNativeComparable(prange))
+	{
+		return m_lLeft == prange->m_lLeft;
+	}
+
+	return m_pcomp->Equals(m_pdatumLeft, pdatumLeft);
 }
 
 //---------------------------------------------------------------------------
@@ -295,18 +509,18 @@ CRange::FStartsBefore(CRange *prange)
 		return (NULL == m_pdatumLeft);
 	}
 
-	if (NULL == m_pdatumLeft || m_pcomp->IsLessThan(m_pdatumLeft, pdatumLeft))
+	if (NULL == m_pdatumLeft)
 	{
 		return true;
 	}
 
-	if (m_pcomp->IsGreaterThan(m_pdatumLeft, pdatumLeft))
+	INT iCmp = ICompare(m_pdatumLeft, m_lLeft, pdatumLeft, prange->m_lLeft,
+						FNativeComparable(prange));
+	if (0 != iCmp)
 	{
-		return false;
+		return (0 > iCmp);
 	}
 
-	GPOS_ASSERT(m_pcomp->Equals(m_pdatumLeft, pdatumLeft));
-
 	return (EriIncluded == m_eriLeft && EriExcluded == prange->EriLeft());
 }
 
@@ -329,19 +543,18 @@ CRange::FEndsAfter(CRange *prange)
 		return (NULL == m_pdatumRight);
 	}
 
-	if (NULL == m_pdatumRight ||
-		m_pcomp->IsGreaterThan(m_pdatumRight, pdatumRight))
+	if (NULL == m_pdatumRight)
 	{
 		return true;
 	}
 
-	if (m_pcomp->IsLessThan(m_pdatumRight, pdatumRight))
+	INT iCmp = ICompare(m_pdatumRight, m_lRight, pdatumRight,
+						prange->m_lRight, FNativeComparable(prange));
+	if (0 != iCmp)
 	{
-		return false;
+		return (0 < iCmp);
 	}
 
-	GPOS_ASSERT(m_pcomp->Equals(m_pdatumRight, pdatumRight));
-
 	return (EriIncluded == m_eriRight && EriExcluded == prange->EriRight());
 }
 
@@ -372,8 +585,17 @@ CRange::FEndsWithOrAfter(CRange *prange)
 		return false;
 	}
 
-	return (m_pcomp->Equals(m_pdatumRight, pdatumRight) &&
-			m_eriRight == prange->EriRight());
+	if (m_eriRight != prange->EriRight())
+	{
+		return false;
+	}
+
+	if (FNativeComparable(prange))
+	{
+		return m_lRight == prange->m_lRight;
+	}
+
+	return m_pcomp->Equals(m_pdatumRight, pdatumRight);
 }
 
 //---------------------------------------------------------------------------
@@ -387,8 +609,17 @@ CRange::FEndsWithOrAfter(CRange *prange)
 BOOL
 CRange::FPoint() const
 {
-	return (EriIncluded == m_eriLeft && EriIncluded == m_eriRight &&
-			m_pcomp->Equals(m_pdatumRight, m_pdatumLeft));
+	if (EriIncluded != m_eriLeft || EriIncluded != m_eriRight)
+	{
+		return false;
+	}
+
+	if (EnkNone != m_enk)
+	{
+		return m_lLeft == m_lRight;
+	}
+
+	return m_pcomp->Equals(m_pdatumRight, m_pdatumLeft);
 }
 
 //---------------------------------------------------------------------------
@@ -442,9 +673,7 @@ CRange::PexprScalar(CMemoryPool *mp, const CColRef *colref)
 CExpression *
 CRange::PexprEquality(CMemoryPool *mp, const CColRef *colref)
 {
-	if (NULL == m_pdatumLeft || NULL == m_pdatumRight ||
-		!m_pcomp->Equals(m_pdatumLeft, m_pdatumRight) ||
-		EriExcluded == m_eriLeft || EriExcluded == m_eriRight)
+	if (NULL == m_pdatumLeft || NULL == m_pdatumRight || !FPoint())
 	{
 		// not an equality predicate
 		return NULL;
@@ -636,8 +865,9 @@ CRange::PrngDifferenceRight(CMemoryPool *mp, CRange *prange)
 CRange *
 CRange::PrngExtend(CMemoryPool *mp, CRange *prange)
 {
-	if ((EriIncluded == prange->EriLeft() || EriIncluded == m_eriRight) &&
-		(m_pcomp->Equals(prange->PdatumLeft(), m_pdatumRight)))
+	if (NULL != m_pdatumRight &&
+		(EriIncluded == prange->EriLeft() || EriIncluded == m_eriRight) &&
+		FUpperBoundEqualsLowerBound(prange))
 	{
 		// ranges are contiguous so combine them into one
 		m_mdid->AddRef();
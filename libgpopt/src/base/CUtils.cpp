@@ -1067,9 +1067,30 @@ CUtils::FPhysicalOuterJoin(COperator *pop)
 	return COperator::EopPhysicalLeftOuterNLJoin == pop->Eopid() ||
 		   COperator::EopPhysicalLeftOuterIndexNLJoin == pop->Eopid() ||
 		   COperator::EopPhysicalLeftOuterHashJoin == pop->Eopid() ||
+		   COperator::EopPhysicalFullOuterHashJoin == pop->Eopid() ||
+		   COperator::EopPhysicalRightOuterHashJoin == pop->Eopid() ||
 		   COperator::EopPhysicalCorrelatedLeftOuterNLJoin == pop->Eopid();
 }
 
+// check if the given child of a physical join is null-extended
+BOOL
+CUtils::FNullExtendedJoinChild(COperator *pop, ULONG child_index)
+{
+	GPOS_ASSERT(NULL != pop);
+
+	switch (pop->Eopid())
+	{
+		case COperator::EopPhysicalFullOuterHashJoin:
+			return true;
+
+		case COperator::EopPhysicalRightOuterHashJoin:
+			return 0 == child_index;
+
+		default:
+			return 1 == child_index && FPhysicalOuterJoin(pop);
+	}
+}
+
 // check if a given operator is a physical agg
 BOOL
 CUtils::FPhysicalScan(COperator *pop)
@@ -4200,6 +4221,16 @@ CUtils::CPointCmp(const void *val1, const void *val2)
 	return 1;
 }
 
+// compares two LINTs
+INT
+CUtils::ILintCmp(const void *val1, const void *val2)
+{
+	const LINT l1 = *static_cast<const LINT *>(val1);
+	const LINT l2 = *static_cast<const LINT *>(val2);
+
+	return (l1 > l2) - (l1 < l2);
+}
+
 // check if the equivalance classes are disjoint
 BOOL
 CUtils::FEquivalanceClassesDisjoint(CMemoryPool *mp,
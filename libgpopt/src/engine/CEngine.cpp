@@ -10,6 +10,7 @@
 //---------------------------------------------------------------------------
 #include "gpos/base.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/common/syslibwrapper.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
@@ -38,6 +39,7 @@
 #include "gpopt/operators/CPhysicalMotionGather.h"
 #include "gpopt/operators/CPhysicalAgg.h"
 #include "gpopt/operators/CPhysicalSort.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 
 #include "gpopt/search/CGroup.h"
@@ -49,6 +51,7 @@
 #include "gpopt/search/CScheduler.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "gpopt/xforms/CXformFactory.h"
+#include "gpopt/xforms/CXformStats.h"
 
 #include "naucrates/traceflags/traceflags.h"
 
@@ -62,6 +65,10 @@
 #define GPOPT_MEM_UNIT (1024 * 1024)
 #define GPOPT_MEM_UNIT_NAME "MB"
 
+// minimum number of memo groups, after the query is copied in, for search
+// guided by xform statistics to skip unproductive xforms
+#define GPOPT_XFORM_STATS_MIN_GROUPS 20
+
 using namespace gpopt;
 
 //---------------------------------------------------------------------------
@@ -78,6 +85,15 @@ CEngine::CEngine(CMemoryPool *mp)
 	  m_search_stage_array(NULL),
 	  m_ulCurrSearchStage(0),
 	  m_pmemo(NULL),
+	  m_ullMemoryBudget(0),
+	  m_ullRequestedAtInit(0),
+	  m_fMemoryBudgetExceeded(false),
+	  m_ulDeadline(0),
+	  m_fDeadlineExceeded(false),
+	  m_fPlanFound(false),
+	  m_fSkipUnproductiveXforms(false),
+	  m_ulReleasedCostContexts(0),
+	  m_pprofile(NULL),
 	  m_pexprEnforcerPattern(NULL),
 	  m_xforms(NULL),
 	  m_pdrgpulpXformCalls(NULL),
@@ -167,6 +183,19 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 	}
 	GPOS_ASSERT(0 < m_search_stage_array->Size());
 
+	m_ullMemoryBudget = ULLONG(COptCtxt::PoctxtFromTLS()
+								   ->GetOptimizerConfig()
+								   ->GetHint()
+								   ->UlMemoryBudget()) *
+						1024;
+	m_ullRequestedAtInit = m_mp->TotalRequestedSize();
+
+	m_ulDeadline = COptCtxt::PoctxtFromTLS()
+					   ->GetOptimizerConfig()
+					   ->GetHint()
+					   ->UlOptimizationDeadline();
+	m_clockDeadline.Restart();
+
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
 		// initialize per-stage xform calls array
@@ -198,6 +227,11 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 	m_pqc = pqc;
 	InitLogicalExpression(m_pqc->Pexpr());
 
+	// only large queries are worth the risk of missing an alternative
+	m_fSkipUnproductiveXforms =
+		GPOS_FTRACE(EopttraceXformStatsGuidedSearch) &&
+		GPOPT_XFORM_STATS_MIN_GROUPS <= m_pmemo->UlpGroups();
+
 	m_pqc->PdrgpcrSystemCols()->AddRef();
 	COptCtxt::PoctxtFromTLS()->SetReqdSystemCols(m_pqc->PdrgpcrSystemCols());
 }
@@ -361,6 +395,12 @@ CEngine::InsertXformResult(
 	GPOS_ASSERT(CXform::ExfInvalid != exfidOrigin);
 	GPOS_ASSERT(NULL != pgexprOrigin);
 
+	if (GPOS_FTRACE(EopttraceRecordXformStats))
+	{
+		CXformStats::Pxfstats()->Record(exfidOrigin, pgexprOrigin->Arity(),
+										pxfres->Pdrgpexpr()->Size());
+	}
+
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics) &&
 		0 < pxfres->Pdrgpexpr()->Size())
 	{
@@ -720,6 +760,10 @@ CEngine::ApplyTransformations(CMemoryPool *pmpLocal, CXformSet *xform_set,
 	{
 		GPOS_CHECK_ABORT;
 		CXform *pxform = CXformFactory::Pxff()->Pxf(xsi.TBit());
+		if (pxform->FExploration() && !FExplorationAllowed(pgexpr))
+		{
+			continue;
+		}
 
 		// transform group expression, and insert results to memo
 		CXformResult *pxfres = GPOS_NEW(m_mp) CXformResult(m_mp);
@@ -731,7 +775,7 @@ CEngine::ApplyTransformations(CMemoryPool *pmpLocal, CXformSet *xform_set,
 						  ulElapsedTime, ulNumberOfBindings);
 		pxfres->Release();
 
-		if (PssCurrent()->FTimedOut())
+		if (FStageTimedOut())
 		{
 			break;
 		}
@@ -755,7 +799,7 @@ CEngine::TransitionGroupExpression(CMemoryPool *pmpLocal,
 	GPOS_ASSERT(CGroupExpression::estExplored == estTarget ||
 				CGroupExpression::estImplemented == estTarget);
 
-	if (PssCurrent()->FTimedOut())
+	if (FStageTimedOut())
 	{
 		return;
 	}
@@ -815,7 +859,7 @@ CEngine::TransitionGroup(CMemoryPool *pmpLocal, CGroup *pgroup,
 	// check stack size
 	GPOS_CHECK_STACK_SIZE;
 
-	if (PssCurrent()->FTimedOut())
+	if (FStageTimedOut())
 	{
 		return;
 	}
@@ -863,7 +907,7 @@ CEngine::TransitionGroup(CMemoryPool *pmpLocal, CGroup *pgroup,
 										  estGExprTargetState);
 			}
 
-			if (PssCurrent()->FTimedOut())
+			if (FStageTimedOut())
 			{
 				break;
 			}
@@ -980,7 +1024,7 @@ CEngine::PccOptimizeChild(
 	CGroupExpression *pgexprChildBest =
 		PgexprOptimize(pgroupChild, pocChild, pgexpr);
 	pocChild->Release();
-	if (NULL == pgexprChildBest || PssCurrent()->FTimedOut())
+	if (NULL == pgexprChildBest || FStageTimedOut())
 	{
 		// failed to generate a plan for the child, or search stage is timed-out
 		return NULL;
@@ -1207,7 +1251,7 @@ CEngine::PgexprOptimize(CGroup *pgroup, COptimizationContext *poc,
 				OptimizeGroupExpression(pgexprCurrent, poc);
 			}
 
-			if (PssCurrent()->FTimedOut())
+			if (FStageTimedOut())
 			{
 				break;
 			}
@@ -1248,7 +1292,7 @@ CEngine::Explore()
 	GPOS_ASSERT(!PgroupRoot()->FExplored());
 
 	TransitionGroup(m_mp, PgroupRoot(), CGroup::estExplored /*estTarget*/);
-	GPOS_ASSERT_IMP(!PssCurrent()->FTimedOut(), PgroupRoot()->FExplored());
+	GPOS_ASSERT_IMP(!FStageTimedOut(), PgroupRoot()->FExplored());
 }
 
 
@@ -1270,7 +1314,7 @@ CEngine::Implement()
 	GPOS_ASSERT(!PgroupRoot()->FImplemented());
 
 	TransitionGroup(m_mp, PgroupRoot(), CGroup::estImplemented /*estTarget*/);
-	GPOS_ASSERT_IMP(!PssCurrent()->FTimedOut(), PgroupRoot()->FImplemented());
+	GPOS_ASSERT_IMP(!FStageTimedOut(), PgroupRoot()->FImplemented());
 }
 
 
@@ -1294,6 +1338,7 @@ CEngine::RecursiveOptimize()
 	const ULONG ulSearchStages = m_search_stage_array->Size();
 	for (ULONG ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++)
 	{
+		CWallClock clock;
 		PssCurrent()->RestartTimer();
 
 		// apply exploration xforms
@@ -1325,6 +1370,13 @@ CEngine::RecursiveOptimize()
 			m_mp, m_pmemo->PgroupRoot(), m_pqc->Prpp(),
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
+		m_fPlanFound = m_fPlanFound || NULL != pexprPlan;
+
+		if (NULL != m_pprofile)
+		{
+			m_pprofile->RecordSearchStage(m_ulCurrSearchStage,
+										  clock.ElapsedUS());
+		}
 
 		FinalizeSearchStage();
 	}
@@ -1535,6 +1587,196 @@ CEngine::FinalizeSearchStage()
 
 	m_ulCurrSearchStage++;
 	m_pmemo->ResetGroupStates();
+
+	// the deadline may have passed after the last check by a job
+	(void) FDeadlineExceeded();
+
+	// release cost contexts that later stages cannot use; after the last
+	// stage, plan enumeration and sampling still need all of them
+	CEnumeratorConfig *pec =
+		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetEnumeratorCfg();
+	if (m_ulCurrSearchStage < m_search_stage_array->Size() &&
+		!FSearchTerminated() && !pec->FEnumerate() && !pec->FSample() &&
+		!GPOS_FTRACE(EopttraceDisableMemoCompaction))
+	{
+		ULONG ulReleased = m_pmemo->UlCompact();
+		m_ulReleasedCostContexts += ulReleased;
+
+		if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+		{
+			CAutoTrace at(m_mp);
+			at.Os() << "[OPT]: Memo compaction (stage "
+					<< m_ulCurrSearchStage - 1 << "): released " << ulReleased
+					<< " cost contexts";
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FMemoryBudgetExceeded
+//
+//	@doc:
+//		Check if the optimization outgrew the memory budget; once exceeded,
+//		the current stage stops exploring and finishes implementing and
+//		optimizing the memo built so far, and no further stages are run.
+//		Memory is measured as the bytes requested from the memory pool since
+//		the engine was initialized, which every pool type accounts for;
+//		freed allocations are not deducted, so this is an upper bound
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FMemoryBudgetExceeded()
+{
+	if (m_fMemoryBudgetExceeded || 0 == m_ullMemoryBudget)
+	{
+		return m_fMemoryBudgetExceeded;
+	}
+
+	ULLONG ullAllocated = m_mp->TotalRequestedSize() - m_ullRequestedAtInit;
+	if (ullAllocated > m_ullMemoryBudget)
+	{
+		m_fMemoryBudgetExceeded = true;
+
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: Memory budget of " << m_ullMemoryBudget / 1024
+				<< " KB exceeded at stage " << m_ulCurrSearchStage << " ("
+				<< ullAllocated / 1024
+				<< " KB allocated), stopping exploration";
+	}
+
+	return m_fMemoryBudgetExceeded;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FDeadlineExceeded
+//
+//	@doc:
+//		Check if the search outlasted the optimization deadline; reading the
+//		wall clock is cheap enough to do once per job step. Once exceeded,
+//		a stage that has no plan to fall back on stops exploring and
+//		finishes implementing and optimizing the memo built so far, while
+//		a stage started after a plan was found is stopped right away
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FDeadlineExceeded()
+{
+	if (m_fDeadlineExceeded || 0 == m_ulDeadline)
+	{
+		return m_fDeadlineExceeded;
+	}
+
+	ULONG ulElapsed = m_clockDeadline.ElapsedMS();
+	if (ulElapsed > m_ulDeadline)
+	{
+		m_fDeadlineExceeded = true;
+
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: Optimization deadline of " << m_ulDeadline
+				<< " ms exceeded at stage " << m_ulCurrSearchStage << " ("
+				<< ulElapsed << " ms elapsed), "
+				<< (m_fPlanFound ? "returning best plan found so far"
+								 : "stopping exploration");
+	}
+
+	return m_fDeadlineExceeded;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FStageTimedOut
+//
+//	@doc:
+//		Check if the jobs of the current search stage must stop
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FStageTimedOut()
+{
+	if (PssCurrent()->FTimedOut())
+	{
+		return true;
+	}
+
+	// a stage is only cut short by the deadline when an earlier stage
+	// found a complete plan, which is then returned
+	return m_fPlanFound && FDeadlineExceeded();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FExplorationAllowed
+//
+//	@doc:
+//		Check if an implementation xform applies to the given group
+//		expression; physical expressions are implementations themselves
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FImplementable(CGroupExpression *pgexpr)
+{
+	GPOS_ASSERT(NULL != pgexpr);
+
+	if (!pgexpr->Pop()->FLogical())
+	{
+		return true;
+	}
+
+	CXformSet *xform_set =
+		CLogical::PopConvert(pgexpr->Pop())->PxfsCandidates(m_mp);
+	BOOL fImplementable =
+		!xform_set->IsDisjoint(CXformFactory::Pxff()->PxfsImplementation());
+	xform_set->Release();
+
+	return fImplementable;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FExplorationAllowed
+//
+//	@doc:
+//		Check if exploration xforms may be applied to the given group
+//		expression; after the memory budget or the deadline is exceeded,
+//		only expressions that no implementation xform applies to, such as
+//		n-ary joins, are explored further, and only until their group has
+//		an alternative that can be implemented, so that the memo can still
+//		produce a plan without running every join order expansion
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FExplorationAllowed(CGroupExpression *pgexpr)
+{
+	GPOS_ASSERT(NULL != pgexpr);
+
+	if (!FExplorationRestricted())
+	{
+		return true;
+	}
+
+	if (FImplementable(pgexpr))
+	{
+		return false;
+	}
+
+	CGroupProxy gp(pgexpr->Pgroup());
+	for (CGroupExpression *pgexprGroup = gp.PgexprFirst(); NULL != pgexprGroup;
+		 pgexprGroup = gp.PgexprNext(pgexprGroup))
+	{
+		if (FImplementable(pgexprGroup))
+		{
+			return false;
+		}
+	}
+
+	return true;
 }
 
 
@@ -1696,6 +1938,7 @@ CEngine::Optimize()
 	const ULONG ulSearchStages = m_search_stage_array->Size();
 	for (ULONG ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++)
 	{
+		CWallClock clock;
 		PssCurrent()->RestartTimer();
 
 		// optimize root group
@@ -1721,6 +1964,13 @@ CEngine::Optimize()
 			m_mp, m_pmemo->PgroupRoot(), m_pqc->Prpp(),
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
+		m_fPlanFound = m_fPlanFound || NULL != pexprPlan;
+
+		if (NULL != m_pprofile)
+		{
+			m_pprofile->RecordSearchStage(m_ulCurrSearchStage,
+										  clock.ElapsedUS());
+		}
 
 		FinalizeSearchStage();
 	}
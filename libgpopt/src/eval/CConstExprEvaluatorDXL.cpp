@@ -19,9 +19,15 @@
 #include "gpopt/eval/IConstDXLNodeEvaluator.h"
 
 #include "gpopt/base/CDrvdPropScalar.h"
+#include "gpopt/base/CRange.h"
+#include "gpopt/base/CUtils.h"
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/operators/CExpression.h"
+#include "gpopt/operators/CScalarCmp.h"
+#include "gpopt/operators/CScalarConst.h"
+
+#include "naucrates/traceflags/traceflags.h"
 
 using namespace gpdxl;
 using namespace gpmd;
@@ -40,11 +46,14 @@ using namespace gpos;
 CConstExprEvaluatorDXL::CConstExprEvaluatorDXL(
 	CMemoryPool *mp, CMDAccessor *md_accessor,
 	IConstDXLNodeEvaluator *pconstdxleval)
-	: m_pconstdxleval(pconstdxleval),
+	: m_mp(mp),
+	  m_pconstdxleval(pconstdxleval),
 	  m_trexpr2dxl(mp, md_accessor, NULL /*pdrgpiSegments*/,
 				   false /*fInitColumnFactory*/),
-	  m_trdxl2expr(mp, md_accessor, false /*fInitColumnFactory*/)
+	  m_trdxl2expr(mp, md_accessor, false /*fInitColumnFactory*/),
+	  m_phmccexpr(NULL)
 {
+	m_phmccexpr = GPOS_NEW(mp) ConstCmpToExprMap(mp);
 }
 
 //---------------------------------------------------------------------------
@@ -57,6 +66,110 @@ CConstExprEvaluatorDXL::CConstExprEvaluatorDXL(
 //---------------------------------------------------------------------------
 CConstExprEvaluatorDXL::~CConstExprEvaluatorDXL()
 {
+	m_phmccexpr->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::SConstCmp::HashValue
+//
+//	@doc:
+//		Hash function
+//
+//---------------------------------------------------------------------------
+ULONG
+CConstExprEvaluatorDXL::SConstCmp::HashValue(const SConstCmp *pcc)
+{
+	ULONG ulHash = pcc->m_mdid_op->HashValue();
+	ulHash = CombineHashes(ulHash, pcc->m_pdatumLeft->HashValue());
+
+	return CombineHashes(ulHash, pcc->m_pdatumRight->HashValue());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::SConstCmp::Equals
+//
+//	@doc:
+//		Equality function
+//
+//---------------------------------------------------------------------------
+BOOL
+CConstExprEvaluatorDXL::SConstCmp::Equals(const SConstCmp *pccFst,
+										  const SConstCmp *pccSnd)
+{
+	return pccFst->m_mdid_op->Equals(pccSnd->m_mdid_op) &&
+		   pccFst->m_pdatumLeft->Matches(pccSnd->m_pdatumLeft) &&
+		   pccFst->m_pdatumRight->Matches(pccSnd->m_pdatumRight);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::PexprEvalNative
+//
+//	@doc:
+//		Fold a comparison between two non-null constants whose native keys
+//		belong to the same domain by comparing the keys. Return NULL for
+//		other comparisons, including comparisons with a cast, which are left
+//		to the DXL evaluator
+//
+//---------------------------------------------------------------------------
+CExpression *
+CConstExprEvaluatorDXL::PexprEvalNative(CExpression *pexpr) const
+{
+	if (!CUtils::FScalarConst((*pexpr)[0]) ||
+		!CUtils::FScalarConst((*pexpr)[1]))
+	{
+		return NULL;
+	}
+
+	IDatum *pdatumLeft =
+		CScalarConst::PopConvert((*pexpr)[0]->Pop())->GetDatum();
+	IDatum *pdatumRight =
+		CScalarConst::PopConvert((*pexpr)[1]->Pop())->GetDatum();
+
+	CRange::ENativeKey enk = CRange::EnkDatum(pdatumLeft);
+	if (CRange::EnkNone == enk || enk != CRange::EnkDatum(pdatumRight))
+	{
+		return NULL;
+	}
+
+	if (CRange::EnkInt == enk &&
+		GPOS_FTRACE(EopttraceUseExternalConstantExpressionEvaluationForInts))
+	{
+		return NULL;
+	}
+
+	const LINT lLeft = CRange::LNativeKey(pdatumLeft);
+	const LINT lRight = CRange::LNativeKey(pdatumRight);
+
+	BOOL result = false;
+	switch (CScalarCmp::PopConvert(pexpr->Pop())->ParseCmpType())
+	{
+		case IMDType::EcmptEq:
+			result = lLeft == lRight;
+			break;
+		case IMDType::EcmptNEq:
+		case IMDType::EcmptIDF:
+			result = lLeft != lRight;
+			break;
+		case IMDType::EcmptL:
+			result = lLeft < lRight;
+			break;
+		case IMDType::EcmptLEq:
+			result = lLeft <= lRight;
+			break;
+		case IMDType::EcmptG:
+			result = lLeft > lRight;
+			break;
+		case IMDType::EcmptGEq:
+			result = lLeft >= lRight;
+			break;
+		default:
+			return NULL;
+	}
+
+	return CUtils::PexprScalarConstBool(m_mp, result);
 }
 
 //---------------------------------------------------------------------------
@@ -77,17 +190,65 @@ CConstExprEvaluatorDXL::PexprEval(CExpression *pexpr)
 	{
 		GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiEvalUnsupportedScalarExpr);
 	}
+
+	CExpression *pexprResult = PexprEvalNative(pexpr);
+	if (NULL != pexprResult)
+	{
+		return pexprResult;
+	}
+
+	// look up comparisons between plain constants among the results of
+	// earlier evaluations
+	BOOL fConstCmp =
+		CUtils::FScalarConst((*pexpr)[0]) && CUtils::FScalarConst((*pexpr)[1]);
+	IMDId *mdid_op = CScalarCmp::PopConvert(pexpr->Pop())->MdIdOp();
+	IDatum *pdatumLeft = NULL;
+	IDatum *pdatumRight = NULL;
+	if (fConstCmp)
+	{
+		pdatumLeft = CScalarConst::PopConvert((*pexpr)[0]->Pop())->GetDatum();
+		pdatumRight = CScalarConst::PopConvert((*pexpr)[1]->Pop())->GetDatum();
+
+		mdid_op->AddRef();
+		pdatumLeft->AddRef();
+		pdatumRight->AddRef();
+		SConstCmp cc(mdid_op, pdatumLeft, pdatumRight);
+
+		pexprResult = m_phmccexpr->Find(&cc);
+		if (NULL != pexprResult)
+		{
+			pexprResult->AddRef();
+			return pexprResult;
+		}
+	}
+
 	CDXLNode *pdxlnExpr = m_trexpr2dxl.PdxlnScalar(pexpr);
 	CDXLNode *pdxlnResult = m_pconstdxleval->EvaluateExpr(pdxlnExpr);
 
 	GPOS_ASSERT(EdxloptypeScalar ==
 				pdxlnResult->GetOperator()->GetDXLOperatorType());
 
-	CExpression *pexprResult =
+	pexprResult =
 		m_trdxl2expr.PexprTranslateScalar(pdxlnResult, NULL /*colref_array*/);
 	pdxlnResult->Release();
 	pdxlnExpr->Release();
 
+	if (fConstCmp)
+	{
+		// the given expression may live in a shorter lived memory pool, so
+		// the key holds copies of the constants
+		mdid_op->AddRef();
+		SConstCmp *pcc = GPOS_NEW(m_mp)
+			SConstCmp(mdid_op, pdatumLeft->MakeCopy(m_mp),
+					  pdatumRight->MakeCopy(m_mp));
+		pexprResult->AddRef();
+#ifdef GPOS_DEBUG
+		BOOL fInserted =
+#endif	// GPOS_DEBUG
+			m_phmccexpr->Insert(pcc, pexprResult);
+		GPOS_ASSERT(fInserted);
+	}
+
 	return pexprResult;
 }
 
@@ -17,6 +17,7 @@
 #include "gpopt/mdcache/CMDCache.h"
 #include "gpopt/exception.h"
 #include "gpopt/xforms/CXformFactory.h"
+#include "gpopt/xforms/CXformStats.h"
 #include "gpos/_api.h"
 #include "naucrates/init.h"
 
@@ -55,6 +56,11 @@ gpopt_init()
 	{
 		return;
 	}
+
+	if (GPOS_OK != gpopt::CXformStats::Init())
+	{
+		return;
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -73,6 +79,8 @@ gpopt_terminate()
 
 	CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(mp);
 
+	CXformStats::Pxfstats()->Shutdown();
+
 	CXformFactory::Pxff()->Shutdown();
 #endif	// GPOS_DEBUG
 }
@@ -15,6 +15,7 @@
 #include "gpos/common/CTimerUser.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/task/CAutoSuspendAbort.h"
+#include "gpos/task/CAutoTraceFlag.h"
 #include "gpos/error/CAutoTrace.h"
 
 #include "gpopt/base/CColRefSetIter.h"
@@ -22,12 +23,14 @@
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/mdcache/CMDCache.h"
 
 
 #include "naucrates/exception.h"
 #include "naucrates/traceflags/traceflags.h"
 
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
 
 #include "naucrates/md/IMDCacheObject.h"
 #include "naucrates/md/IMDRelation.h"
@@ -512,10 +515,16 @@ CMDAccessor::GetImdObj(IMDId *mdid)
 
 		CMDKey mdkey(mdid);
 
+		// preloaded built-in objects are neither fetched nor cached again
 		CAutoP<CacheAccessorMD> a_pmdcacc;
-		a_pmdcacc = GPOS_NEW(m_mp) CacheAccessorMD(m_pcache);
-		a_pmdcacc->Lookup(&mdkey);
-		IMDCacheObject *pmdobjNew = a_pmdcacc->Val();
+		IMDCacheObject *pmdobjNew = PimdobjBuiltin(mdid);
+		if (NULL == pmdobjNew)
+		{
+			a_pmdcacc = GPOS_NEW(m_mp) CacheAccessorMD(m_pcache);
+			a_pmdcacc->Lookup(&mdkey);
+			pmdobjNew = a_pmdcacc->Val();
+		}
+
 		if (NULL == pmdobjNew)
 		{
 			// object not found in MD cache: retrieve it from MD provider
@@ -619,6 +628,215 @@ CMDAccessor::GetImdObj(IMDId *mdid)
 	return pimdobj;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PimdobjBuiltin
+//
+//	@doc:
+//		Lookup an object in the preloaded built-in metadata; the returned
+//		object is pinned for the caller, NULL if the object was not preloaded
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CMDAccessor::PimdobjBuiltin(IMDId *mdid)
+{
+	MDCache *pcacheBuiltin = CMDCache::PcacheBuiltin();
+	if (NULL == pcacheBuiltin)
+	{
+		return NULL;
+	}
+
+	CMDKey mdkey(mdid);
+	CacheAccessorMD mdcacc(pcacheBuiltin);
+	mdcacc.Lookup(&mdkey);
+
+	return mdcacc.Val();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PimdobjPreload
+//
+//	@doc:
+//		Fetch an object from its MD provider into the preloaded built-in
+//		metadata unless it is there already; preloaded objects are kept
+//		until the built-in metadata is reset, so the returned object is not
+//		pinned for the caller
+//
+//---------------------------------------------------------------------------
+const IMDCacheObject *
+CMDAccessor::PimdobjPreload(IMDId *mdid)
+{
+	MDCache *pcacheBuiltin = CMDCache::PcacheBuiltin();
+	GPOS_ASSERT(NULL != pcacheBuiltin);
+
+	CMDKey mdkey(mdid);
+	CacheAccessorMD mdcacc(pcacheBuiltin);
+	mdcacc.Lookup(&mdkey);
+	IMDCacheObject *pmdobj = mdcacc.Val();
+
+	if (NULL == pmdobj)
+	{
+		CAutoP<CWStringBase> a_pstr;
+		a_pstr = Pmdp(mdid->Sysid())->GetMDObjDXLStr(m_mp, this, mdid);
+		GPOS_ASSERT(NULL != a_pstr.Value());
+
+		CMemoryPool *mp = mdcacc.Pmp();
+		IMDCacheObject *pmdobjNew = gpdxl::CDXLUtils::ParseDXLToIMDIdCacheObj(
+			mp, a_pstr.Value(), NULL /* XSD path */);
+		GPOS_ASSERT(NULL != pmdobjNew);
+
+		CAutoP<CMDKey> a_pmdkeyCache;
+		a_pmdkeyCache = GPOS_NEW(mp) CMDKey(pmdobjNew->MDId());
+		pmdobj = mdcacc.Insert(a_pmdkeyCache.Value(), pmdobjNew);
+		(void) a_pmdkeyCache.Reset();
+
+		// the cache holds its own reference of the inserted object, or of
+		// the object another accessor inserted in the meantime
+		pmdobjNew->Release();
+	}
+	else
+	{
+		// release the reference taken by the lookup
+		pmdobj->Release();
+	}
+
+	return pmdobj;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::FPreloadIfExists
+//
+//	@doc:
+//		Preload an object that the MD provider may not have, such as a cast
+//		between two types; return false if it does not have it
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDAccessor::FPreloadIfExists(IMDId *mdid)
+{
+	GPOS_TRY
+	{
+		(void) PimdobjPreload(mdid);
+
+		return true;
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (!GPOS_MATCH_EX(ex, gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound))
+		{
+			GPOS_RETHROW(ex);
+		}
+
+		GPOS_RESET_EX;
+
+		return false;
+	}
+	GPOS_CATCH_END;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PreloadBuiltinMetadata
+//
+//	@doc:
+//		Preload the built-in types of the given system into the built-in
+//		metadata shared by all accessors, along with their comparison
+//		operators, their aggregates, and the casts and comparisons between
+//		them; the objects are never evicted, and are dropped only when the
+//		metadata cache is reset. Return the number of objects preloaded.
+//
+//		Built-in objects must not change while they are preloaded; call
+//		CMDCache::ResetBuiltin() otherwise, e.g. after a catalog upgrade.
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDAccessor::PreloadBuiltinMetadata(CSystemId sysid)
+{
+	IMDProvider *pmdp = Pmdp(sysid);
+	ULONG ulPreloaded = 0;
+
+	IMdIdArray *pdrgpmdidTypes = GPOS_NEW(m_mp) IMdIdArray(m_mp);
+	for (ULONG ul = 0; ul < IMDType::EtiGeneric; ul++)
+	{
+		IMDId *mdid_type = pmdp->MDId(m_mp, sysid, (IMDType::ETypeInfo) ul);
+		pdrgpmdidTypes->Append(mdid_type);
+
+		const IMDType *pmdtype =
+			dynamic_cast<const IMDType *>(PimdobjPreload(mdid_type));
+		GPOS_ASSERT(NULL != pmdtype);
+		ulPreloaded++;
+
+		for (ULONG ulCmp = 0; ulCmp < IMDType::EcmptIDF; ulCmp++)
+		{
+			IMDId *mdid_op =
+				pmdtype->GetMdidForCmpType((IMDType::ECmpType) ulCmp);
+			if (IMDId::IsValid(mdid_op) && FPreloadIfExists(mdid_op))
+			{
+				ulPreloaded++;
+			}
+		}
+
+		for (ULONG ulAgg = 0; ulAgg < IMDType::EaggGeneric; ulAgg++)
+		{
+			IMDId *mdid_agg =
+				pmdtype->GetMdidForAggType((IMDType::EAggType) ulAgg);
+			if (IMDId::IsValid(mdid_agg) && FPreloadIfExists(mdid_agg))
+			{
+				ulPreloaded++;
+			}
+		}
+	}
+
+	// casts and comparisons between different built-in types
+	const ULONG ulTypes = pdrgpmdidTypes->Size();
+	for (ULONG ulSrc = 0; ulSrc < ulTypes; ulSrc++)
+	{
+		for (ULONG ulDest = 0; ulDest < ulTypes; ulDest++)
+		{
+			if (ulSrc == ulDest)
+			{
+				continue;
+			}
+
+			CMDIdGPDB *mdid_src = CMDIdGPDB::CastMdid((*pdrgpmdidTypes)[ulSrc]);
+			CMDIdGPDB *mdid_dest =
+				CMDIdGPDB::CastMdid((*pdrgpmdidTypes)[ulDest]);
+
+			mdid_src->AddRef();
+			mdid_dest->AddRef();
+			IMDId *mdid_cast = GPOS_NEW(m_mp) CMDIdCast(mdid_src, mdid_dest);
+			if (FPreloadIfExists(mdid_cast))
+			{
+				ulPreloaded++;
+			}
+			mdid_cast->Release();
+
+			for (ULONG ulCmp = 0; ulCmp < IMDType::EcmptIDF; ulCmp++)
+			{
+				mdid_src->AddRef();
+				mdid_dest->AddRef();
+				IMDId *mdid_cmp = GPOS_NEW(m_mp) CMDIdScCmp(
+					mdid_src, mdid_dest, (IMDType::ECmpType) ulCmp);
+				if (FPreloadIfExists(mdid_cmp))
+				{
+					ulPreloaded++;
+				}
+				mdid_cmp->Release();
+			}
+		}
+	}
+
+	pdrgpmdidTypes->Release();
+
+	return ulPreloaded;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::RetrieveRel
@@ -1251,9 +1469,16 @@ CMDAccessor::Serialize(COstream &oos)
 	}
 
 	// Now that we're done iterating and no longer hold the lock,
-	// serialize the entries.
+	// serialize the entries. Cache objects do not keep a DXL copy of
+	// themselves, so they are serialized on demand, directly into the
+	// stream.
+	CAutoTraceFlag atf(EtraceSimulateAbort, false);
+	CXMLSerializer xml_serializer(m_mp, oos, false /*indentation*/);
 	for (ul = 0; ul < nentries; ul++)
-		oos << cacheEntries[ul]->GetStrRepr()->GetBuffer();
+	{
+		cacheEntries[ul]->Serialize(&xml_serializer);
+		GPOS_CHECK_ABORT;
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -21,9 +21,29 @@ using namespace gpopt;
 // global instance of metadata cache
 CMDAccessor::MDCache *CMDCache::m_pcache = NULL;
 
+// global instance of preloaded built-in metadata
+CMDAccessor::MDCache *CMDCache::m_pcacheBuiltin = NULL;
+
 // maximum size of the cache
 ULLONG CMDCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::PcacheCreate
+//
+//	@doc:
+//		Create a metadata cache with the given quota
+//
+//---------------------------------------------------------------------------
+CMDAccessor::MDCache *
+CMDCache::PcacheCreate(ULLONG ullCacheQuota)
+{
+	return CCacheFactory::CreateCache<IMDCacheObject *, CMDKey *>(
+		true /*fUnique*/, ullCacheQuota, CMDKey::UlHashMDKey,
+		CMDKey::FEqualMDKey);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::Init
@@ -37,9 +57,12 @@ CMDCache::Init()
 {
 	GPOS_ASSERT(NULL == m_pcache && "Metadata cache was already created");
 
-	m_pcache = CCacheFactory::CreateCache<IMDCacheObject *, CMDKey *>(
-		true /*fUnique*/, m_ullCacheQuota, CMDKey::UlHashMDKey,
-		CMDKey::FEqualMDKey);
+	m_pcache = PcacheCreate(m_ullCacheQuota);
+
+	if (NULL == m_pcacheBuiltin)
+	{
+		m_pcacheBuiltin = PcacheCreate(UNLIMITED_CACHE_QUOTA);
+	}
 }
 
 
@@ -56,6 +79,9 @@ CMDCache::Shutdown()
 {
 	GPOS_DELETE(m_pcache);
 	m_pcache = NULL;
+
+	GPOS_DELETE(m_pcacheBuiltin);
+	m_pcacheBuiltin = NULL;
 }
 
 
@@ -114,7 +140,8 @@ CMDCache::ULLGetCacheEvictionCounter()
 //		CMDCache::Reset
 //
 //	@doc:
-//		Reset metadata cache
+//		Reset metadata cache, along with the preloaded built-in metadata,
+//		which may have come from a different provider
 //
 //---------------------------------------------------------------------------
 void
@@ -125,8 +152,33 @@ CMDCache::Reset()
 	CAutoTraceFlag atf3(EtraceSimulateIOError, false);
 	CAutoTraceFlag atf4(EtraceSimulateNetError, false);
 
-	Shutdown();
+	GPOS_DELETE(m_pcache);
+	m_pcache = NULL;
+	GPOS_DELETE(m_pcacheBuiltin);
+	m_pcacheBuiltin = NULL;
 	Init();
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::ResetBuiltin
+//
+//	@doc:
+//		Drop all preloaded built-in metadata; accessors created afterwards
+//		fetch built-in objects through the metadata cache again
+//
+//---------------------------------------------------------------------------
+void
+CMDCache::ResetBuiltin()
+{
+	GPOS_ASSERT(NULL != m_pcacheBuiltin && "Metadata cache was not created");
+
+	CAutoTraceFlag atf1(EtraceSimulateOOM, false);
+	CAutoTraceFlag atf2(EtraceSimulateAbort, false);
+
+	GPOS_DELETE(m_pcacheBuiltin);
+	m_pcacheBuiltin = PcacheCreate(UNLIMITED_CACHE_QUOTA);
+}
+
 // EOF
@@ -0,0 +1,542 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CMinidumpBenchmark.cpp
+//
+//	@doc:
+//		Implementation of repeated minidump replay measuring optimization
+//		time and memory
+//---------------------------------------------------------------------------
+
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/io/CFileReader.h"
+#include "gpos/io/CFileWriter.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+
+#include "gpopt/cost/ICostModel.h"
+#include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/minidump/CMetadataAccessorFactory.h"
+#include "gpopt/minidump/CMinidumpBenchmark.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+
+using namespace gpopt;
+
+// minimum number of segments minidumps are optimized for; matches the
+// minidump tests, so that the benchmark optimizes the same plans
+#define GPOPT_BENCHMARK_SEGMENTS 2
+
+// number of search stages reported per minidump
+#define GPOPT_BENCHMARK_MAX_STAGES 16
+
+// time differences below this many micro-seconds are not regressions
+#define GPOPT_BENCHMARK_MIN_TIME_DELTA 1000
+
+// report column names of measurements
+static const CHAR *rgszMeasure[CMinidumpBenchmark::EmSentinel] = {
+	"parse_us",	   "translate_query_us", "preprocess_us",
+	"search_us",   "translate_plan_us",	 "serialize_us",
+	"total_us",	   "peak_memory_bytes",	 "mdcache_bytes",
+};
+
+// report column name of search stage times
+#define GPOPT_BENCHMARK_STAGES_COLUMN "stages_us"
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		ComparatorUllong
+//
+//	@doc:
+//		Comparator for sorting measurements
+//
+//---------------------------------------------------------------------------
+static INT
+ComparatorUllong(const void *pvLeft, const void *pvRight)
+{
+	ULLONG ullLeft = *(const ULLONG *) pvLeft;
+	ULLONG ullRight = *(const ULLONG *) pvRight;
+
+	if (ullLeft < ullRight)
+	{
+		return -1;
+	}
+
+	if (ullLeft > ullRight)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::SResult::SResult
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::SResult::SResult(CMemoryPool *mp, const CHAR *szFileName)
+	: m_szFileName(NULL)
+{
+	ULONG length = clib::Strlen(szFileName);
+	m_szFileName = GPOS_NEW_ARRAY(mp, CHAR, length + 1);
+	(void) clib::Memcpy(m_szFileName, szFileName, length + 1);
+
+	for (ULONG ul = 0; ul < EmSentinel; ul++)
+	{
+		m_rgullMeasure[ul] = 0;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::SResult::~SResult
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::SResult::~SResult()
+{
+	GPOS_DELETE_ARRAY(m_szFileName);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::CMinidumpBenchmark
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::CMinidumpBenchmark(CMemoryPool *mp, ULONG ulIterations)
+	: m_mp(mp),
+	  m_ulIterations(ulIterations),
+	  m_pdrgpresult(NULL),
+	  m_strReport(mp)
+{
+	GPOS_ASSERT(0 < ulIterations);
+
+	m_pdrgpresult = GPOS_NEW(mp) SResultArray(mp);
+
+	// report header
+	m_strReport.AppendCharArray("file");
+	for (ULONG ul = 0; ul < EmSentinel; ul++)
+	{
+		m_strReport.AppendFormat(",%s", rgszMeasure[ul]);
+	}
+	m_strReport.AppendCharArray("," GPOPT_BENCHMARK_STAGES_COLUMN "\n");
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::~CMinidumpBenchmark
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::~CMinidumpBenchmark()
+{
+	m_pdrgpresult->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::Replay
+//
+//	@doc:
+//		Replay a minidump once in a fresh memory pool, filling in the
+//		measurements and the time spent in each search stage
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::Replay(const CHAR *szFileName, ULLONG *rgullMeasure,
+						   ULLONG *rgullStage, ULONG ulMaxStages,
+						   ULONG *pulStages)
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWallClock clock;
+
+	// parse minidump and load its metadata
+	CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, szFileName);
+	GPOS_CHECK_ABORT;
+
+	CMDCache::Reset();
+	CMetadataAccessorFactory factory(mp, pdxlmd, szFileName);
+	rgullMeasure[EmParse] = clock.ElapsedUS();
+
+	COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+	if (NULL == optimizer_config)
+	{
+		optimizer_config = COptimizerConfig::PoconfDefault(mp);
+	}
+	else
+	{
+		optimizer_config->AddRef();
+	}
+
+	ULONG ulSegments = GPOPT_BENCHMARK_SEGMENTS;
+	if (NULL != optimizer_config->GetCostModel() &&
+		ulSegments < optimizer_config->GetCostModel()->UlHosts())
+	{
+		ulSegments = optimizer_config->GetCostModel()->UlHosts();
+	}
+
+	// optimize
+	COptimizationProfile profile(mp);
+	CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+		mp, factory.Pmda(), pdxlmd, szFileName, ulSegments, 1 /*ulSessionId*/,
+		1 /*ulCmdId*/, optimizer_config, NULL /*pceeval*/, &profile);
+
+	rgullMeasure[EmTranslateQuery] =
+		profile.UlPhaseTime(COptimizationProfile::EphTranslateQuery);
+	rgullMeasure[EmPreprocess] =
+		profile.UlPhaseTime(COptimizationProfile::EphPreprocess);
+	rgullMeasure[EmSearch] =
+		profile.UlPhaseTime(COptimizationProfile::EphSearch);
+	rgullMeasure[EmTranslatePlan] =
+		profile.UlPhaseTime(COptimizationProfile::EphTranslatePlan);
+
+	*pulStages = std::min(profile.UlSearchStages(), ulMaxStages);
+	for (ULONG ul = 0; ul < *pulStages; ul++)
+	{
+		rgullStage[ul] = profile.UlSearchStageTime(ul);
+	}
+
+	// serialize plan
+	clock.Restart();
+	CStringDynamic *pstrPlan = CDXLUtils::SerializePlan(
+		mp, pdxlnPlan, optimizer_config->GetEnumeratorCfg()->GetPlanId(),
+		optimizer_config->GetEnumeratorCfg()->GetPlanSpaceSize(),
+		true /*serialize_header_footer*/, false /*indentation*/);
+	rgullMeasure[EmSerialize] = clock.ElapsedUS();
+
+	rgullMeasure[EmTotal] = 0;
+	for (ULONG ul = EmParse; ul < EmTotal; ul++)
+	{
+		rgullMeasure[EmTotal] += rgullMeasure[ul];
+	}
+
+	rgullMeasure[EmPeakMemory] = mp->PeakAllocatedSize();
+	rgullMeasure[EmMDCacheMemory] = CMDCache::Pcache()->TotalAllocatedSize();
+
+	// cleanup
+	GPOS_DELETE(pstrPlan);
+	pdxlnPlan->Release();
+	optimizer_config->Release();
+	GPOS_DELETE(pdxlmd);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::UllMedian
+//
+//	@doc:
+//		Sort the given measurements and return their median
+//
+//---------------------------------------------------------------------------
+ULLONG
+CMinidumpBenchmark::UllMedian(ULLONG *rgull, ULONG size)
+{
+	GPOS_ASSERT(0 < size);
+
+	clib::Qsort(rgull, size, sizeof(ULLONG), ComparatorUllong);
+
+	return rgull[size / 2];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::Run
+//
+//	@doc:
+//		Replay the given minidump and add its median measurements to the
+//		report
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::Run(const CHAR *szFileName)
+{
+	GPOS_ASSERT(NULL != szFileName);
+
+	// measurements of all iterations, grouped by measurement
+	CAutoRg<ULLONG> a_rgullMeasure;
+	a_rgullMeasure = GPOS_NEW_ARRAY(m_mp, ULLONG, EmSentinel * m_ulIterations);
+
+	// search stage times of all iterations, grouped by stage
+	CAutoRg<ULLONG> a_rgullStage;
+	a_rgullStage = GPOS_NEW_ARRAY(m_mp, ULLONG,
+								  GPOPT_BENCHMARK_MAX_STAGES * m_ulIterations);
+	(void) clib::Memset(
+		a_rgullStage.Rgt(), 0,
+		GPOPT_BENCHMARK_MAX_STAGES * m_ulIterations * sizeof(ULLONG));
+
+	ULONG ulStages = 0;
+	for (ULONG ulIter = 0; ulIter < m_ulIterations; ulIter++)
+	{
+		ULLONG rgullMeasure[EmSentinel];
+		ULLONG rgullStage[GPOPT_BENCHMARK_MAX_STAGES];
+		ULONG ulIterStages = 0;
+		Replay(szFileName, rgullMeasure, rgullStage,
+			   GPOPT_BENCHMARK_MAX_STAGES, &ulIterStages);
+
+		for (ULONG ul = 0; ul < EmSentinel; ul++)
+		{
+			a_rgullMeasure[ul * m_ulIterations + ulIter] = rgullMeasure[ul];
+		}
+
+		for (ULONG ul = 0; ul < ulIterStages; ul++)
+		{
+			a_rgullStage[ul * m_ulIterations + ulIter] = rgullStage[ul];
+		}
+		ulStages = std::max(ulStages, ulIterStages);
+	}
+
+	SResult *presult = GPOS_NEW(m_mp) SResult(m_mp, szFileName);
+	m_pdrgpresult->Append(presult);
+
+	m_strReport.AppendCharArray(szFileName);
+	for (ULONG ul = 0; ul < EmSentinel; ul++)
+	{
+		presult->m_rgullMeasure[ul] = UllMedian(
+			a_rgullMeasure.Rgt() + ul * m_ulIterations, m_ulIterations);
+		m_strReport.AppendFormat(",%llu", presult->m_rgullMeasure[ul]);
+	}
+
+	m_strReport.AppendCharArray(",");
+	for (ULONG ul = 0; ul < ulStages; ul++)
+	{
+		m_strReport.AppendFormat(
+			"%s%llu", (0 == ul) ? "" : ";",
+			UllMedian(a_rgullStage.Rgt() + ul * m_ulIterations,
+					  m_ulIterations));
+	}
+	m_strReport.AppendCharArray("\n");
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::WriteReport
+//
+//	@doc:
+//		Write report to the given file
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::WriteReport(const CHAR *szFileName) const
+{
+	GPOS_ASSERT(NULL != szFileName);
+
+	CFileWriter fw;
+	fw.Open(szFileName, S_IRUSR | S_IWUSR);
+	fw.Write((const BYTE *) m_strReport.GetBuffer(), m_strReport.Length());
+	fw.Close();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::PresultParse
+//
+//	@doc:
+//		Parse a report line into a result; return NULL for the header and
+//		for malformed lines
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::SResult *
+CMinidumpBenchmark::PresultParse(const CHAR *szLine) const
+{
+	const CHAR *szSep = clib::Strchr(szLine, ',');
+	if (NULL == szSep)
+	{
+		return NULL;
+	}
+
+	ULONG length = szSep - szLine;
+	CAutoRg<CHAR> a_szFileName;
+	a_szFileName = GPOS_NEW_ARRAY(m_mp, CHAR, length + 1);
+	(void) clib::Memcpy(a_szFileName.Rgt(), szLine, length);
+	a_szFileName[length] = CHAR_EOS;
+
+	SResult *presult = GPOS_NEW(m_mp) SResult(m_mp, a_szFileName.Rgt());
+	for (ULONG ul = 0; ul < EmSentinel; ul++)
+	{
+		const CHAR *szValue = szSep + 1;
+		CHAR *szEnd = NULL;
+		LINT lValue = clib::Strtoll(szValue, &szEnd, 10 /*base*/);
+		if (szEnd == szValue || ',' != *szEnd || 0 > lValue)
+		{
+			// header or malformed line
+			GPOS_DELETE(presult);
+			return NULL;
+		}
+
+		presult->m_rgullMeasure[ul] = (ULLONG) lValue;
+		szSep = szEnd;
+	}
+
+	return presult;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::PresultFind
+//
+//	@doc:
+//		Find the result of the given minidump
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::SResult *
+CMinidumpBenchmark::PresultFind(const CHAR *szFileName) const
+{
+	const ULONG size = m_pdrgpresult->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		SResult *presult = (*m_pdrgpresult)[ul];
+		if (0 == clib::Strcmp(presult->m_szFileName, szFileName))
+		{
+			return presult;
+		}
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::FRegressed
+//
+//	@doc:
+//		Check if a measurement exceeds its baseline value by more than the
+//		given percentage
+//
+//---------------------------------------------------------------------------
+BOOL
+CMinidumpBenchmark::FRegressed(ULLONG ullCurrent, ULLONG ullBaseline,
+							   ULONG ulTolerance)
+{
+	return ullCurrent * 100 > ullBaseline * (100 + ulTolerance);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::UlRegressions
+//
+//	@doc:
+//		Check results against a baseline report; minidumps missing from
+//		either report are ignored
+//
+//---------------------------------------------------------------------------
+ULONG
+CMinidumpBenchmark::UlRegressions(const CHAR *szBaselineFileName,
+								  ULONG ulTolerance) const
+{
+	GPOS_ASSERT(NULL != szBaselineFileName);
+
+	CFileReader fr;
+	fr.Open(szBaselineFileName);
+	const ULONG_PTR file_size = fr.FileSize();
+
+	CAutoRg<CHAR> a_szBaseline;
+	a_szBaseline = GPOS_NEW_ARRAY(m_mp, CHAR, file_size + 1);
+	ULONG_PTR read_size =
+		fr.ReadBytesToBuffer((BYTE *) a_szBaseline.Rgt(), file_size);
+	fr.Close();
+	a_szBaseline[read_size] = CHAR_EOS;
+
+	ULONG ulRegressions = 0;
+	CHAR *szLine = a_szBaseline.Rgt();
+	while (CHAR_EOS != *szLine)
+	{
+		CHAR *szNextLine = clib::Strchr(szLine, '\n');
+		if (NULL != szNextLine)
+		{
+			*szNextLine = CHAR_EOS;
+			szNextLine++;
+		}
+		else
+		{
+			szNextLine = szLine + clib::Strlen(szLine);
+		}
+
+		SResult *presultBaseline = PresultParse(szLine);
+		SResult *presult = NULL;
+		if (NULL != presultBaseline)
+		{
+			presult = PresultFind(presultBaseline->m_szFileName);
+		}
+
+		if (NULL != presult)
+		{
+			const EMeasure rgem[] = {EmTotal, EmPeakMemory};
+			for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgem); ul++)
+			{
+				ULLONG ullCurrent = presult->m_rgullMeasure[rgem[ul]];
+				ULLONG ullBaseline = presultBaseline->m_rgullMeasure[rgem[ul]];
+				if (!FRegressed(ullCurrent, ullBaseline, ulTolerance) ||
+					(EmTotal == rgem[ul] &&
+					 ullCurrent < ullBaseline + GPOPT_BENCHMARK_MIN_TIME_DELTA))
+				{
+					continue;
+				}
+
+				ulRegressions++;
+
+				CAutoTrace at(m_mp);
+				at.Os() << "[BENCH]: " << presult->m_szFileName << ": "
+						<< rgszMeasure[rgem[ul]] << " regressed from "
+						<< ullBaseline << " to " << ullCurrent;
+			}
+		}
+
+		GPOS_DELETE(presultBaseline);
+		szLine = szNextLine;
+	}
+
+	return ulRegressions;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::SzMeasure
+//
+//	@doc:
+//		Column name of the given measurement in the report
+//
+//---------------------------------------------------------------------------
+const CHAR *
+CMinidumpBenchmark::SzMeasure(EMeasure em)
+{
+	GPOS_ASSERT(EmSentinel > em);
+
+	return rgszMeasure[em];
+}
+
+// EOF
@@ -42,6 +42,7 @@
 #include "gpopt/optimizer/COptimizer.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
+#include "gpopt/xforms/CXformStats.h"
 
 #include <fstream>
 
@@ -299,7 +300,8 @@ CDXLNode *
 CMinidumperUtils::PdxlnExecuteMinidump(
 	CMemoryPool *mp, CMDAccessor *md_accessor, CDXLMinidump *pdxlmd,
 	const CHAR *file_name, ULONG ulSegments, ULONG ulSessionId, ULONG ulCmdId,
-	COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval)
+	COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval,
+	COptimizationProfile *pprofile)
 {
 	GPOS_ASSERT(NULL != md_accessor);
 	GPOS_ASSERT(NULL != pdxlmd->GetQueryDXLRoot() &&
@@ -328,6 +330,10 @@ CMinidumperUtils::PdxlnExecuteMinidump(
 		GPOS_UNSET_TRACE(EopttraceEnableConstantExpressionEvaluation);
 	}
 
+	// the plan of a minidump must not depend on the minidumps replayed
+	// before it in the same process
+	CXformStats::Pxfstats()->Reset();
+
 	CErrorHandlerStandard errhdl;
 	GPOS_TRY_HDL(&errhdl)
 	{
@@ -336,7 +342,7 @@ CMinidumperUtils::PdxlnExecuteMinidump(
 			pdxlmd->PdrgpdxlnQueryOutput(), pdxlmd->GetCTEProducerDXLArray(),
 			pceeval, ulSegments, ulSessionId, ulCmdId,
 			NULL,  // search_stage_array
-			optimizer_config, file_name);
+			optimizer_config, file_name, pprofile);
 	}
 	GPOS_CATCH_EX(ex)
 	{
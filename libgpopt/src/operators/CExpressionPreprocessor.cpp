@@ -20,6 +20,7 @@
 #include "gpopt/exception.h"
 
 #include "gpopt/operators/CWindowPreprocessor.h"
+#include "gpopt/operators/CJoinEliminator.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CNormalizer.h"
@@ -2651,10 +2652,23 @@ CExpressionPreprocessor::PexprPreprocess(
 	GPOS_CHECK_ABORT;
 	pexprNormalized1->Release();
 
+	CExpression *pexprJoinsEliminated = pexprLOJToIJ;
+
+	if (NULL != pcrsOutputAndOrderCols &&
+		GPOS_FTRACE(EopttraceEnableJoinElimination))
+	{
+		// (18.5) remove joins to unique keys and foreign keys whose inner
+		// side contributes no output columns
+		pexprJoinsEliminated = CJoinEliminator::PexprEliminateJoins(
+			mp, pexprLOJToIJ, pcrsOutputAndOrderCols);
+		GPOS_CHECK_ABORT;
+		pexprLOJToIJ->Release();
+	}
+
 	// (19) collapse cascaded inner and left outer joins
-	CExpression *pexprCollapsed = PexprCollapseJoins(mp, pexprLOJToIJ);
+	CExpression *pexprCollapsed = PexprCollapseJoins(mp, pexprJoinsEliminated);
 	GPOS_CHECK_ABORT;
-	pexprLOJToIJ->Release();
+	pexprJoinsEliminated->Release();
 
 	// (20) after transforming outer joins to inner joins, we may be able to generate more predicates from constraints
 	CExpression *pexprWithPreds =
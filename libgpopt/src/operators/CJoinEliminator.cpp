@@ -0,0 +1,575 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CJoinEliminator.cpp
+//
+//	@doc:
+//		Preprocessing routines that remove joins to relations contributing
+//		no output columns
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CColRefTable.h"
+#include "gpopt/base/CKeyCollection.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CJoinEliminator.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/operators/ops.h"
+
+using namespace gpopt;
+using namespace gpmd;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::FPassThrough
+//
+//	@doc:
+//		Check if the operator needs only the columns required from it and
+//		the columns it uses from its children; other operators, such as set
+//		operations or CTE producers, map their children's columns by
+//		position and need all of them
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinEliminator::FPassThrough(COperator *pop)
+{
+	switch (pop->Eopid())
+	{
+		case COperator::EopLogicalSelect:
+		case COperator::EopLogicalProject:
+		case COperator::EopLogicalGbAgg:
+		case COperator::EopLogicalLimit:
+		case COperator::EopLogicalSequenceProject:
+		case COperator::EopLogicalInnerJoin:
+		case COperator::EopLogicalNAryJoin:
+		case COperator::EopLogicalLeftOuterJoin:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::PexprEliminateLOJ
+//
+//	@doc:
+//		Remove a left outer join whose inner child contributes no required
+//		columns, and whose predicate equates a key of the inner child to
+//		columns and constants that are fixed for a given outer row; each
+//		outer row then matches at most one inner row and is emitted exactly
+//		once. Return NULL if the join cannot be removed
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinEliminator::PexprEliminateLOJ(CMemoryPool *mp, CExpression *pexprLOJ,
+								   CColRefSet *pcrsReqd)
+{
+	GPOS_ASSERT(COperator::EopLogicalLeftOuterJoin ==
+				pexprLOJ->Pop()->Eopid());
+
+	CExpression *pexprOuter = (*pexprLOJ)[0];
+	CExpression *pexprInner = (*pexprLOJ)[1];
+	CExpression *pexprScalar = (*pexprLOJ)[2];
+
+	CColRefSet *pcrsInner = pexprInner->DeriveOutputColumns();
+	CKeyCollection *pkc = pexprInner->DeriveKeyCollection();
+	if (pcrsInner->FIntersects(pcrsReqd) || NULL == pkc)
+	{
+		return NULL;
+	}
+
+	// collect the inner columns equated to an outer column, an outer
+	// reference or a constant
+	CColRefSet *pcrsBound = GPOS_NEW(mp) CColRefSet(mp);
+	CExpressionArray *pdrgpexprConj =
+		CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+	const ULONG ulConjuncts = pdrgpexprConj->Size();
+	for (ULONG ul = 0; ul < ulConjuncts; ul++)
+	{
+		CExpression *pexprConj = (*pdrgpexprConj)[ul];
+		if (!CPredicateUtils::IsEqualityOp(pexprConj))
+		{
+			continue;
+		}
+
+		for (ULONG ulSide = 0; ulSide < 2; ulSide++)
+		{
+			CExpression *pexprKey = (*pexprConj)[ulSide];
+			CExpression *pexprOther = (*pexprConj)[1 - ulSide];
+			if (!CUtils::FScalarIdent(pexprKey) ||
+				!(CUtils::FScalarIdent(pexprOther) ||
+				  CUtils::FScalarConst(pexprOther)))
+			{
+				continue;
+			}
+
+			const CColRef *colref =
+				CScalarIdent::PopConvert(pexprKey->Pop())->Pcr();
+			if (pcrsInner->FMember(colref) &&
+				!pexprOther->DeriveUsedColumns()->FIntersects(pcrsInner))
+			{
+				pcrsBound->Include(colref);
+			}
+		}
+	}
+	pdrgpexprConj->Release();
+
+	BOOL fUnique = pkc->FKey(pcrsBound, false /*fExactMatch*/);
+	pcrsBound->Release();
+
+	if (!fUnique)
+	{
+		return NULL;
+	}
+
+	pexprOuter->AddRef();
+	return pexprOuter;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::PexprEliminateFKJoin
+//
+//	@doc:
+//		Remove a child of an inner or n-ary join that is a Get of a relation
+//		referenced by a foreign key of another child, and that contributes
+//		no required columns. Return NULL if no child can be removed
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinEliminator::PexprEliminateFKJoin(CMemoryPool *mp, CExpression *pexprJoin,
+									  CColRefSet *pcrsReqd)
+{
+	COperator *pop = pexprJoin->Pop();
+	GPOS_ASSERT(COperator::EopLogicalInnerJoin == pop->Eopid() ||
+				COperator::EopLogicalNAryJoin == pop->Eopid());
+
+	if (COperator::EopLogicalNAryJoin == pop->Eopid() &&
+		CLogicalNAryJoin::PopConvert(pop)->HasOuterJoinChildren())
+	{
+		return NULL;
+	}
+
+	const ULONG ulRelChildren = pexprJoin->Arity() - 1;
+	for (ULONG ul = 0; ul < ulRelChildren; ul++)
+	{
+		CExpression *pexprChild = (*pexprJoin)[ul];
+		if (COperator::EopLogicalGet != pexprChild->Pop()->Eopid() ||
+			pexprChild->DeriveOutputColumns()->FIntersects(pcrsReqd))
+		{
+			continue;
+		}
+
+		CExpression *pexprResult =
+			PexprRemoveReferencedChild(mp, pexprJoin, ul);
+		if (NULL != pexprResult)
+		{
+			return pexprResult;
+		}
+	}
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::PexprRemoveReferencedChild
+//
+//	@doc:
+//		Remove the given join child if every conjunct of the join predicate
+//		that uses its columns equates one of them to a column of the same
+//		other child, and these columns form a declared foreign key; rows of
+//		the referencing child with NULL keys have no match, so they are
+//		filtered out unless the keys are known not to be NULL. Return NULL
+//		if the child cannot be removed
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinEliminator::PexprRemoveReferencedChild(CMemoryPool *mp,
+											CExpression *pexprJoin,
+											ULONG ulReferenced)
+{
+	const ULONG ulRelChildren = pexprJoin->Arity() - 1;
+	CExpression *pexprReferenced = (*pexprJoin)[ulReferenced];
+	CExpression *pexprScalar = (*pexprJoin)[ulRelChildren];
+	CColRefSet *pcrsReferenced = pexprReferenced->DeriveOutputColumns();
+
+	CExpressionArray *pdrgpexprConj =
+		CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+	CExpressionArray *pdrgpexprRemaining = GPOS_NEW(mp) CExpressionArray(mp);
+	CColRefArray *pdrgpcrKey = GPOS_NEW(mp) CColRefArray(mp);
+	CColRefArray *pdrgpcrReferenced = GPOS_NEW(mp) CColRefArray(mp);
+	ULONG ulReferencing = gpos::ulong_max;
+	BOOL fValid = true;
+
+	const ULONG ulConjuncts = pdrgpexprConj->Size();
+	for (ULONG ul = 0; fValid && ul < ulConjuncts; ul++)
+	{
+		CExpression *pexprConj = (*pdrgpexprConj)[ul];
+		if (!pexprConj->DeriveUsedColumns()->FIntersects(pcrsReferenced))
+		{
+			pexprConj->AddRef();
+			pdrgpexprRemaining->Append(pexprConj);
+			continue;
+		}
+
+		fValid = CPredicateUtils::FPlainEquality(pexprConj);
+		if (!fValid)
+		{
+			break;
+		}
+
+		CColRef *pcrReferenced = const_cast<CColRef *>(
+			CScalarIdent::PopConvert((*pexprConj)[0]->Pop())->Pcr());
+		CColRef *pcrKey = const_cast<CColRef *>(
+			CScalarIdent::PopConvert((*pexprConj)[1]->Pop())->Pcr());
+		if (!pcrsReferenced->FMember(pcrReferenced))
+		{
+			std::swap(pcrReferenced, pcrKey);
+		}
+
+		// find the child producing the key column; all key columns must
+		// come from the same child
+		ULONG ulChild = 0;
+		while (ulChild < ulRelChildren &&
+			   !(*pexprJoin)[ulChild]->DeriveOutputColumns()->FMember(pcrKey))
+		{
+			ulChild++;
+		}
+
+		fValid = pcrsReferenced->FMember(pcrReferenced) &&
+				 ulChild < ulRelChildren && ulChild != ulReferenced &&
+				 (gpos::ulong_max == ulReferencing || ulChild == ulReferencing);
+		if (fValid)
+		{
+			ulReferencing = ulChild;
+			pdrgpcrKey->Append(pcrKey);
+			pdrgpcrReferenced->Append(pcrReferenced);
+		}
+	}
+	pdrgpexprConj->Release();
+
+	fValid = fValid && gpos::ulong_max != ulReferencing &&
+			 FForeignKey(mp, (*pexprJoin)[ulReferencing], pexprReferenced,
+						 pdrgpcrKey, pdrgpcrReferenced);
+	pdrgpcrReferenced->Release();
+
+	if (!fValid)
+	{
+		pdrgpcrKey->Release();
+		pdrgpexprRemaining->Release();
+		return NULL;
+	}
+
+	// filter out rows with NULL keys, which have no match
+	CColRefSet *pcrsNullable = GPOS_NEW(mp) CColRefSet(mp, pdrgpcrKey);
+	pcrsNullable->Difference(
+		(*pexprJoin)[ulReferencing]->DeriveNotNullColumns());
+	CColRefSetIter crsi(*pcrsNullable);
+	while (crsi.Advance())
+	{
+		pdrgpexprRemaining->Append(CUtils::PexprIsNotNull(
+			mp, CUtils::PexprScalarIdent(mp, crsi.Pcr())));
+	}
+	pcrsNullable->Release();
+	pdrgpcrKey->Release();
+
+	CExpressionArray *pdrgpexprChildren = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < ulRelChildren; ul++)
+	{
+		if (ul != ulReferenced)
+		{
+			(*pexprJoin)[ul]->AddRef();
+			pdrgpexprChildren->Append((*pexprJoin)[ul]);
+		}
+	}
+
+	CExpression *pexprPred =
+		CPredicateUtils::PexprConjunction(mp, pdrgpexprRemaining);
+	if (1 == pdrgpexprChildren->Size())
+	{
+		CExpression *pexprChild = (*pdrgpexprChildren)[0];
+		pexprChild->AddRef();
+		pdrgpexprChildren->Release();
+
+		return CUtils::PexprSafeSelect(mp, pexprChild, pexprPred);
+	}
+
+	pdrgpexprChildren->Append(pexprPred);
+	if (3 == pdrgpexprChildren->Size())
+	{
+		return GPOS_NEW(mp) CExpression(
+			mp, GPOS_NEW(mp) CLogicalInnerJoin(mp), pdrgpexprChildren);
+	}
+
+	return GPOS_NEW(mp)
+		CExpression(mp, GPOS_NEW(mp) CLogicalNAryJoin(mp), pdrgpexprChildren);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::FForeignKey
+//
+//	@doc:
+//		Check if the given key columns of the referencing expression form a
+//		declared foreign key to the given columns of the referenced Get,
+//		pairing the columns in the same order; the referenced columns must
+//		also be a key of the referenced relation
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinEliminator::FForeignKey(CMemoryPool *mp, CExpression *pexprReferencing,
+							 CExpression *pexprReferenced,
+							 CColRefArray *pdrgpcrKey,
+							 CColRefArray *pdrgpcrReferenced)
+{
+	GPOS_ASSERT(0 < pdrgpcrKey->Size());
+	GPOS_ASSERT(pdrgpcrKey->Size() == pdrgpcrReferenced->Size());
+
+	CKeyCollection *pkc = pexprReferenced->DeriveKeyCollection();
+	CColRefSet *pcrsReferenced = GPOS_NEW(mp) CColRefSet(mp, pdrgpcrReferenced);
+	BOOL fKey = NULL != pkc && pkc->FKey(pcrsReferenced, false /*fExactMatch*/);
+	pcrsReferenced->Release();
+
+	CLogicalGet *popGetKey = PopGetProducing(pexprReferencing, (*pdrgpcrKey)[0]);
+	if (!fKey || NULL == popGetKey)
+	{
+		return false;
+	}
+
+	CLogicalGet *popGetReferenced =
+		CLogicalGet::PopConvert(pexprReferenced->Pop());
+	IMDId *pmdidReferenced = popGetReferenced->Ptabdesc()->MDId();
+
+	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+	const IMDRelation *pmdrelKey =
+		md_accessor->RetrieveRel(popGetKey->Ptabdesc()->MDId());
+	const IMDRelation *pmdrelReferenced =
+		md_accessor->RetrieveRel(pmdidReferenced);
+
+	BOOL fForeignKey = false;
+	const ULONG ulForeignKeys = pmdrelKey->ForeignKeyCount();
+	for (ULONG ul = 0; !fForeignKey && ul < ulForeignKeys; ul++)
+	{
+		const CMDForeignKey *pmdfk = pmdrelKey->ForeignKeyAt(ul);
+		if (!pmdfk->ReferencedRelMdid()->Equals(pmdidReferenced))
+		{
+			continue;
+		}
+
+		// the join must equate exactly the column pairs of the foreign key
+		CColRefArray *pdrgpcrFKKey = GPOS_NEW(mp) CColRefArray(mp);
+		CColRefArray *pdrgpcrFKReferenced = GPOS_NEW(mp) CColRefArray(mp);
+		fForeignKey = true;
+		const ULONG ulKeyCols = pmdfk->KeyColumnCount();
+		for (ULONG ulCol = 0; fForeignKey && ulCol < ulKeyCols; ulCol++)
+		{
+			CColRef *pcrKey =
+				PcrAtMDPos(popGetKey, pmdrelKey, pmdfk->KeyColumnAt(ulCol));
+			CColRef *pcrReferenced =
+				PcrAtMDPos(popGetReferenced, pmdrelReferenced,
+						   pmdfk->ReferencedColumnAt(ulCol));
+			fForeignKey = NULL != pcrKey && NULL != pcrReferenced &&
+						  FContainsPair(pdrgpcrKey, pdrgpcrReferenced, pcrKey,
+										pcrReferenced);
+			pdrgpcrFKKey->Append(pcrKey);
+			pdrgpcrFKReferenced->Append(pcrReferenced);
+		}
+
+		const ULONG ulPairs = pdrgpcrKey->Size();
+		for (ULONG ulPair = 0; fForeignKey && ulPair < ulPairs; ulPair++)
+		{
+			fForeignKey = FContainsPair(pdrgpcrFKKey, pdrgpcrFKReferenced,
+										(*pdrgpcrKey)[ulPair],
+										(*pdrgpcrReferenced)[ulPair]);
+		}
+
+		pdrgpcrFKKey->Release();
+		pdrgpcrFKReferenced->Release();
+	}
+
+	return fForeignKey;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::FContainsPair
+//
+//	@doc:
+//		Check if the given column pair appears at the same position of the
+//		given pair of arrays
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinEliminator::FContainsPair(CColRefArray *pdrgpcrFst,
+							   CColRefArray *pdrgpcrSnd, CColRef *pcrFst,
+							   CColRef *pcrSnd)
+{
+	GPOS_ASSERT(pdrgpcrFst->Size() == pdrgpcrSnd->Size());
+
+	const ULONG size = pdrgpcrFst->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (pcrFst == (*pdrgpcrFst)[ul] && pcrSnd == (*pdrgpcrSnd)[ul])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::PopGetProducing
+//
+//	@doc:
+//		Find the Get operator producing the given column in the given tree;
+//		the values of a column produced by a Get are values of the scanned
+//		relation, or NULL when the column is null-extended by an outer join
+//
+//---------------------------------------------------------------------------
+CLogicalGet *
+CJoinEliminator::PopGetProducing(CExpression *pexpr, CColRef *colref)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	if (COperator::EopLogicalGet == pexpr->Pop()->Eopid())
+	{
+		return CLogicalGet::PopConvert(pexpr->Pop());
+	}
+
+	const ULONG arity = pexpr->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CExpression *pexprChild = (*pexpr)[ul];
+		if (pexprChild->Pop()->FLogical() &&
+			pexprChild->DeriveOutputColumns()->FMember(colref))
+		{
+			return PopGetProducing(pexprChild, colref);
+		}
+	}
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::PcrAtMDPos
+//
+//	@doc:
+//		Find the output column of the Get for the given position in the
+//		metadata of the scanned relation
+//
+//---------------------------------------------------------------------------
+CColRef *
+CJoinEliminator::PcrAtMDPos(CLogicalGet *popGet, const IMDRelation *pmdrel,
+							ULONG ulPos)
+{
+	if (ulPos >= pmdrel->ColumnCount())
+	{
+		return NULL;
+	}
+
+	const INT iAttno = pmdrel->GetMdCol(ulPos)->AttrNum();
+	CColRefArray *pdrgpcrOutput = popGet->PdrgpcrOutput();
+	const ULONG size = pdrgpcrOutput->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CColRef *colref = (*pdrgpcrOutput)[ul];
+		if (iAttno == CColRefTable::PcrConvert(colref)->AttrNum())
+		{
+			return colref;
+		}
+	}
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinEliminator::PexprEliminateJoins
+//
+//	@doc:
+//		Main driver; the tree is processed top-down, so that a join removed
+//		from a chain of lookup joins no longer requires the columns used by
+//		its predicate from the joins below it
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinEliminator::PexprEliminateJoins(CMemoryPool *mp, CExpression *pexpr,
+									 CColRefSet *pcrsReqd)
+{
+	GPOS_CHECK_STACK_SIZE;
+	GPOS_ASSERT(NULL != pexpr);
+	GPOS_ASSERT(NULL != pcrsReqd);
+
+	COperator *pop = pexpr->Pop();
+
+	// leave scalar expressions, including subqueries, alone
+	if (!pop->FLogical())
+	{
+		pexpr->AddRef();
+		return pexpr;
+	}
+
+	CExpression *pexprEliminated = NULL;
+	if (COperator::EopLogicalLeftOuterJoin == pop->Eopid())
+	{
+		pexprEliminated = PexprEliminateLOJ(mp, pexpr, pcrsReqd);
+	}
+	else if (COperator::EopLogicalInnerJoin == pop->Eopid() ||
+			 COperator::EopLogicalNAryJoin == pop->Eopid())
+	{
+		pexprEliminated = PexprEliminateFKJoin(mp, pexpr, pcrsReqd);
+	}
+
+	if (NULL != pexprEliminated)
+	{
+		// the remaining tree may contain further joins to remove
+		CExpression *pexprResult =
+			PexprEliminateJoins(mp, pexprEliminated, pcrsReqd);
+		pexprEliminated->Release();
+
+		return pexprResult;
+	}
+
+	// compute the columns required from the children
+	CExpressionHandle exprhdl(mp);
+	exprhdl.Attach(pexpr);
+	CColRefSet *pcrsChildReqd = exprhdl.PcrsUsedColumns(mp);
+	pcrsChildReqd->Include(pcrsReqd);
+
+	const ULONG arity = pexpr->Arity();
+	if (!FPassThrough(pop))
+	{
+		for (ULONG ul = 0; ul < arity; ul++)
+		{
+			if (!exprhdl.FScalarChild(ul))
+			{
+				pcrsChildReqd->Include(exprhdl.DeriveOutputColumns(ul));
+			}
+		}
+	}
+
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		pdrgpexpr->Append(PexprEliminateJoins(mp, (*pexpr)[ul], pcrsChildReqd));
+	}
+	pcrsChildReqd->Release();
+
+	pop->AddRef();
+	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+}
+
+// EOF
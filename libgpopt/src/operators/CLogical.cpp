@@ -1059,7 +1059,7 @@ CMaxCard
 CLogical::Maxcard(CExpressionHandle &exprhdl, ULONG ulScalarIndex,
 				  CMaxCard maxcard)
 {
-	// in case of a false condition (when the operator is not Full / Left Outer Join) or a contradiction, maxcard should be zero
+	// in case of a false condition (when the operator is not Full / Left / Right Outer Join) or a contradiction, maxcard should be zero
 	CExpression *pexprScalar = exprhdl.PexprScalarExactChild(ulScalarIndex);
 
 	if (NULL != pexprScalar)
@@ -1072,7 +1072,8 @@ CLogical::Maxcard(CExpressionHandle &exprhdl, ULONG ulScalarIndex,
 
 		if ((CUtils::FScalarConstFalse(pexprScalar) &&
 			 COperator::EopLogicalFullOuterJoin != exprhdl.Pop()->Eopid() &&
-			 COperator::EopLogicalLeftOuterJoin != exprhdl.Pop()->Eopid()) ||
+			 COperator::EopLogicalLeftOuterJoin != exprhdl.Pop()->Eopid() &&
+			 COperator::EopLogicalRightOuterJoin != exprhdl.Pop()->Eopid()) ||
 			exprhdl.DerivePropertyConstraint()->FContradiction())
 		{
 			return CMaxCard(0 /*ull*/);
@@ -598,6 +598,8 @@ CLogicalGbAgg::PxfsCandidates(CMemoryPool *mp) const
 	(void) xform_set->ExchangeSet(CXform::ExfGbAgg2StreamAgg);
 	(void) xform_set->ExchangeSet(CXform::ExfGbAgg2ScalarAgg);
 	(void) xform_set->ExchangeSet(CXform::ExfEagerAgg);
+	(void) xform_set->ExchangeSet(CXform::ExfEagerAggNAryJoin);
+	(void) xform_set->ExchangeSet(CXform::ExfEagerAggLeftOuterJoin);
 	return xform_set;
 }
 
@@ -67,6 +67,7 @@ CLogicalInnerJoin::PxfsCandidates(CMemoryPool *mp) const
 
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoin2NLJoin);
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoin2HashJoin);
+	(void) xform_set->ExchangeSet(CXform::ExfInnerJoin2MergeJoin);
 	(void) xform_set->ExchangeSet(CXform::ExfSubqJoin2Apply);
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoin2IndexGetApply);
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoin2DynamicIndexGetApply);
@@ -91,6 +92,7 @@ CLogicalInnerJoin::PxfsCandidates(CMemoryPool *mp) const
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoinSemiJoinSwap);
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoinAntiSemiJoinSwap);
 	(void) xform_set->ExchangeSet(CXform::ExfInnerJoinAntiSemiJoinNotInSwap);
+	(void) xform_set->ExchangeSet(CXform::ExfInnerJoinSemiJoinReducer);
 
 	return xform_set;
 }
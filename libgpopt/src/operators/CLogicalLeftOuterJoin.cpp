@@ -78,6 +78,8 @@ CLogicalLeftOuterJoin::PxfsCandidates(CMemoryPool *mp) const
 	(void) xform_set->ExchangeSet(CXform::ExfLeftOuterJoin2IndexGetApply);
 	(void) xform_set->ExchangeSet(CXform::ExfLeftOuterJoin2NLJoin);
 	(void) xform_set->ExchangeSet(CXform::ExfLeftOuterJoin2HashJoin);
+	(void) xform_set->ExchangeSet(CXform::ExfLeftOuterJoin2RightOuterJoin);
+	(void) xform_set->ExchangeSet(CXform::ExfLeftOuterJoin2MergeJoin);
 	(void) xform_set->ExchangeSet(
 		CXform::ExfLeftOuter2InnerUnionAllLeftAntiSemiJoin);
 	(void) xform_set->ExchangeSet(
@@ -232,6 +232,8 @@ CLogicalLimit::PxfsCandidates(CMemoryPool *mp) const
 
 	(void) xform_set->ExchangeSet(CXform::ExfImplementLimit);
 	(void) xform_set->ExchangeSet(CXform::ExfSplitLimit);
+	(void) xform_set->ExchangeSet(CXform::ExfPushLimitBelowUnionAll);
+	(void) xform_set->ExchangeSet(CXform::ExfPushLimitBelowLeftOuterJoin);
 
 	return xform_set;
 }
@@ -13,10 +13,17 @@
 #include "gpos/memory/CAutoMemoryPool.h"
 
 #include "gpopt/base/CUtils.h"
+#include "gpopt/base/CWindowOids.h"
 #include "gpopt/operators/CNormalizer.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarNAryJoinPredList.h"
 #include "gpopt/operators/ops.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/base/IDatumInt2.h"
+#include "naucrates/base/IDatumInt4.h"
+#include "naucrates/base/IDatumInt8.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/traceflags/traceflags.h"
 
 using namespace gpopt;
 
@@ -721,6 +728,299 @@ CNormalizer::SplitConjunctForSeqPrj(CMemoryPool *mp, CExpression *pexprSeqPrj,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CNormalizer::FPinsColumn
+//
+//	@doc:
+//		Check if a scalar predicate restricts a column to a single value,
+//		i.e. it equates the column to a constant; a cast on the column is
+//		only allowed if it is binary coercible, since a lossy cast, such as
+//		numeric to integer, maps many values of the column to the constant
+//
+//---------------------------------------------------------------------------
+BOOL
+CNormalizer::FPinsColumn(CExpression *pexprPred)
+{
+	GPOS_ASSERT(NULL != pexprPred);
+
+	if (!CPredicateUtils::IsEqualityOp(pexprPred))
+	{
+		return false;
+	}
+
+	CExpression *pexprLeft = (*pexprPred)[0];
+	CExpression *pexprRight = (*pexprPred)[1];
+	if (CScalarIdent::FCastedScId(pexprLeft) &&
+		CScalarCast::PopConvert(pexprLeft->Pop())->IsBinaryCoercible())
+	{
+		pexprLeft = (*pexprLeft)[0];
+	}
+
+	return COperator::EopScalarIdent == pexprLeft->Pop()->Eopid() &&
+		   (COperator::EopScalarConst == pexprRight->Pop()->Eopid() ||
+			CScalarConst::FCastedConst(pexprRight));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CNormalizer::FLimitableSeqPrj
+//
+//	@doc:
+//		Check if the window functions of a sequence project produce the same
+//		values for its first rows when computed over a limit on its child;
+//		this holds for row_number() and rank() over a single ordering of one
+//		window partition, since every row preceding a row in that ordering
+//		is also among the first rows.
+//
+//		A limit keeps the first rows of the whole input, not of each window
+//		partition, so a window with a PARTITION BY is only limited when the
+//		conjuncts pushed into its child equate every partition column to a
+//		constant
+//
+//---------------------------------------------------------------------------
+BOOL
+CNormalizer::FLimitableSeqPrj(CMemoryPool *mp, CExpression *pexprSeqPrj,
+							  CExpressionArray *pdrgpexprPushable)
+{
+	GPOS_ASSERT(NULL != pexprSeqPrj);
+	GPOS_ASSERT(CLogical::EopLogicalSequenceProject ==
+				pexprSeqPrj->Pop()->Eopid());
+	GPOS_ASSERT(NULL != pdrgpexprPushable);
+
+	CLogicalSequenceProject *popSeqPrj =
+		CLogicalSequenceProject::PopConvert(pexprSeqPrj->Pop());
+	CDistributionSpec *pds = popSeqPrj->Pds();
+	if (CDistributionSpec::EdtHashed == pds->Edt())
+	{
+		CColRefSet *pcrsConst = GPOS_NEW(mp) CColRefSet(mp);
+		const ULONG ulPreds = pdrgpexprPushable->Size();
+		for (ULONG ul = 0; ul < ulPreds; ul++)
+		{
+			CExpression *pexprPred = (*pdrgpexprPushable)[ul];
+			if (FPinsColumn(pexprPred))
+			{
+				pcrsConst->Include(pexprPred->DeriveUsedColumns());
+			}
+		}
+
+		CColRefSet *pcrsPartition =
+			CDistributionSpecHashed::PdsConvert(pds)->PcrsUsed(mp);
+		BOOL fSinglePartition = pcrsConst->ContainsAll(pcrsPartition);
+		pcrsPartition->Release();
+		pcrsConst->Release();
+
+		if (!fSinglePartition)
+		{
+			return false;
+		}
+	}
+	else if (CDistributionSpec::EdtSingleton != pds->Edt())
+	{
+		return false;
+	}
+
+	COrderSpecArray *pdrgpos = popSeqPrj->Pdrgpos();
+	const ULONG ulOrderSpecs = pdrgpos->Size();
+	for (ULONG ul = 1; ul < ulOrderSpecs; ul++)
+	{
+		if (!(*pdrgpos)[0]->Matches((*pdrgpos)[ul]))
+		{
+			return false;
+		}
+	}
+
+	CWindowOids *pwindowoids =
+		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetWindowOids();
+	CExpression *pexprPrjList = (*pexprSeqPrj)[1];
+	const ULONG ulPrjElems = pexprPrjList->Arity();
+	for (ULONG ul = 0; ul < ulPrjElems; ul++)
+	{
+		CExpression *pexprWindowFunc = (*(*pexprPrjList)[ul])[0];
+		if (COperator::EopScalarWindowFunc != pexprWindowFunc->Pop()->Eopid())
+		{
+			return false;
+		}
+
+		OID oid = CMDIdGPDB::CastMdid(CScalarWindowFunc::PopConvert(
+										  pexprWindowFunc->Pop())
+										  ->FuncMdId())
+					  ->Oid();
+		if (pwindowoids->OidRowNumber() != oid && pwindowoids->OidRank() != oid)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CNormalizer::LRowNumberLimit
+//
+//	@doc:
+//		Return the number of rows a filter on a row number computed by a
+//		sequence project lets through, or -1 if the given predicate is not
+//		a comparison of such a row number to an integer constant
+//
+//---------------------------------------------------------------------------
+LINT
+CNormalizer::LRowNumberLimit(CExpression *pexprSeqPrj, CExpression *pexprPred)
+{
+	GPOS_ASSERT(NULL != pexprSeqPrj);
+	GPOS_ASSERT(NULL != pexprPred);
+
+	if (COperator::EopScalarCmp != pexprPred->Pop()->Eopid())
+	{
+		return -1;
+	}
+
+	IMDType::ECmpType ecmpt =
+		CScalarCmp::PopConvert(pexprPred->Pop())->ParseCmpType();
+	CExpression *pexprIdent = (*pexprPred)[0];
+	CExpression *pexprConst = (*pexprPred)[1];
+	if (COperator::EopScalarConst == pexprIdent->Pop()->Eopid())
+	{
+		// constant on the left: the comparison reads the other way round
+		std::swap(pexprIdent, pexprConst);
+		ecmpt = CPredicateUtils::EcmptReverse(ecmpt);
+	}
+
+	if (COperator::EopScalarIdent != pexprIdent->Pop()->Eopid() ||
+		COperator::EopScalarConst != pexprConst->Pop()->Eopid())
+	{
+		return -1;
+	}
+
+	// find the window function computing the compared column
+	const CColRef *colref = CScalarIdent::PopConvert(pexprIdent->Pop())->Pcr();
+	OID oidRowNumber = COptCtxt::PoctxtFromTLS()
+						   ->GetOptimizerConfig()
+						   ->GetWindowOids()
+						   ->OidRowNumber();
+	BOOL fRowNumber = false;
+	CExpression *pexprPrjList = (*pexprSeqPrj)[1];
+	const ULONG ulPrjElems = pexprPrjList->Arity();
+	for (ULONG ul = 0; ul < ulPrjElems; ul++)
+	{
+		CExpression *pexprPrjElem = (*pexprPrjList)[ul];
+		if (colref ==
+			CScalarProjectElement::PopConvert(pexprPrjElem->Pop())->Pcr())
+		{
+			COperator *popFunc = (*pexprPrjElem)[0]->Pop();
+			fRowNumber =
+				COperator::EopScalarWindowFunc == popFunc->Eopid() &&
+				oidRowNumber ==
+					CMDIdGPDB::CastMdid(
+						CScalarWindowFunc::PopConvert(popFunc)->FuncMdId())
+						->Oid();
+			break;
+		}
+	}
+
+	IDatum *datum = CScalarConst::PopConvert(pexprConst->Pop())->GetDatum();
+	if (!fRowNumber || datum->IsNull())
+	{
+		return -1;
+	}
+
+	LINT value = 0;
+	switch (datum->GetDatumType())
+	{
+		case IMDType::EtiInt2:
+			value = dynamic_cast<IDatumInt2 *>(datum)->Value();
+			break;
+		case IMDType::EtiInt4:
+			value = dynamic_cast<IDatumInt4 *>(datum)->Value();
+			break;
+		case IMDType::EtiInt8:
+			value = dynamic_cast<IDatumInt8 *>(datum)->Value();
+			break;
+		default:
+			return -1;
+	}
+
+	switch (ecmpt)
+	{
+		case IMDType::EcmptEq:
+		case IMDType::EcmptLEq:
+			return std::max(value, (LINT) 0);
+		case IMDType::EcmptL:
+			return std::max(value - 1, (LINT) 0);
+		default:
+			return -1;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CNormalizer::PexprAddTopKBelowSeqPrj
+//
+//	@doc:
+//		Add a limit on top of the new child of a limitable sequence project
+//		when one of the conjuncts remaining above the sequence project keeps
+//		only the first k row numbers, so that only k rows are sorted and
+//		windowed; the conjuncts themselves stay above the sequence project
+//
+//---------------------------------------------------------------------------
+CExpression *
+CNormalizer::PexprAddTopKBelowSeqPrj(CMemoryPool *mp, CExpression *pexprSeqPrj,
+									 CExpression *pexprChild,
+									 CExpressionArray *pdrgpexprUnpushable)
+{
+	GPOS_ASSERT(NULL != pexprChild);
+	GPOS_ASSERT(NULL != pdrgpexprUnpushable);
+
+	// a limit added by a previous normalization is not added again
+	if (COperator::EopLogicalLimit == pexprChild->Pop()->Eopid())
+	{
+		return pexprChild;
+	}
+
+	LINT lLimit = -1;
+	const ULONG ulPreds = pdrgpexprUnpushable->Size();
+	for (ULONG ul = 0; ul < ulPreds; ul++)
+	{
+		LINT lPredLimit =
+			LRowNumberLimit(pexprSeqPrj, (*pdrgpexprUnpushable)[ul]);
+		if (0 <= lPredLimit && (0 > lLimit || lPredLimit < lLimit))
+		{
+			lLimit = lPredLimit;
+		}
+	}
+
+	if (0 > lLimit)
+	{
+		return pexprChild;
+	}
+
+	// the limit keeps the first rows in the order of the window functions
+	COrderSpecArray *pdrgpos =
+		CLogicalSequenceProject::PopConvert(pexprSeqPrj->Pop())->Pdrgpos();
+	COrderSpec *pos = NULL;
+	if (0 < pdrgpos->Size())
+	{
+		pos = (*pdrgpos)[0];
+		pos->AddRef();
+	}
+	else
+	{
+		pos = GPOS_NEW(mp) COrderSpec(mp);
+	}
+
+	CLogicalLimit *popLimit = GPOS_NEW(mp)
+		CLogicalLimit(mp, pos, true /* fGlobal */, true /* fHasCount */,
+					  false /*fTopLimitUnderDML*/);
+	return GPOS_NEW(mp) CExpression(mp, popLimit, pexprChild,
+									CUtils::PexprScalarConstInt8(mp, 0),
+									CUtils::PexprScalarConstInt8(mp, lLimit));
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CNormalizer::PushThruSeqPrj
@@ -749,6 +1049,10 @@ CNormalizer::PushThruSeqPrj(CMemoryPool *mp, CExpression *pexprSeqPrj,
 	SplitConjunctForSeqPrj(mp, pexprSeqPrj, pexprConj, &pdrgpexprPushable,
 						   &pdrgpexprUnpushable);
 
+	// check for a top-k before the pushable conjuncts are consumed
+	BOOL fLimitable = GPOS_FTRACE(EopttraceEnableWindowTopK) &&
+					  FLimitableSeqPrj(mp, pexprSeqPrj, pdrgpexprPushable);
+
 	CExpression *pexprNewLogicalChild = NULL;
 	if (0 < pdrgpexprPushable->Size())
 	{
@@ -766,6 +1070,12 @@ CNormalizer::PushThruSeqPrj(CMemoryPool *mp, CExpression *pexprSeqPrj,
 		pexprNewLogicalChild = PexprNormalize(mp, pexprLogicalChild);
 	}
 
+	if (fLimitable)
+	{
+		pexprNewLogicalChild = PexprAddTopKBelowSeqPrj(
+			mp, pexprSeqPrj, pexprNewLogicalChild, pdrgpexprUnpushable);
+	}
+
 	// create a new logical expression based on recursion results
 	COperator *pop = pexprSeqPrj->Pop();
 	pop->AddRef();
@@ -797,11 +797,12 @@ CPhysical::PppsRequiredPushThruNAry(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		if (ppfmReqd->FContainsScanId(part_idx_id))
 		{
 			CExpression *pexpr = ppfmReqd->Pexpr(part_idx_id);
-			// if the current child is inner child and the predicate is IsNull check and the parent is outer join,
-			// don't push IsNull check predicate to the partition filter.
+			// if the current child is null-extended by an outer join and the
+			// predicate is IsNull check, don't push IsNull check predicate to
+			// the partition filter.
 			// for all the other cases, push the filter down.
-			if (!(1 == child_index && CUtils::FScalarNullTest(pexpr) &&
-				  CUtils::FPhysicalOuterJoin(exprhdl.Pop())))
+			if (!(CUtils::FScalarNullTest(pexpr) &&
+				  CUtils::FNullExtendedJoinChild(exprhdl.Pop(), child_index)))
 			{
 				pexpr->AddRef();
 				ppfmResult->AddPartFilter(mp, part_idx_id, pexpr,
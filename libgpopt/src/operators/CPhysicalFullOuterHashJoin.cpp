@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalFullOuterHashJoin.cpp
+//
+//	@doc:
+//		Implementation of full outer hash join operator
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpopt/base/CDistributionSpecHashed.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalFullOuterHashJoin.h"
+
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalFullOuterHashJoin::CPhysicalFullOuterHashJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalFullOuterHashJoin::CPhysicalFullOuterHashJoin(
+	CMemoryPool *mp, CExpressionArray *pdrgpexprOuterKeys,
+	CExpressionArray *pdrgpexprInnerKeys)
+	: CPhysicalHashJoin(mp, pdrgpexprOuterKeys, pdrgpexprInnerKeys)
+{
+	// Req(1 to N) (redistribute, redistribute)
+	// Req(N + 1) (singleton, singleton)
+	SetDistrRequests(UlHashDistributeRequests() + 1);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalFullOuterHashJoin::~CPhysicalFullOuterHashJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalFullOuterHashJoin::~CPhysicalFullOuterHashJoin()
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalFullOuterHashJoin::PdsRequired
+//
+//	@doc:
+//		Compute required distribution of the n-th child
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalFullOuterHashJoin::PdsRequired(CMemoryPool *mp,
+										CExpressionHandle &exprhdl,
+										CDistributionSpec *pdsRequired,
+										ULONG child_index,
+										CDrvdPropArray *pdrgpdpCtxt,
+										ULONG ulOptReq) const
+{
+	return PdsRequiredNoBroadcast(mp, exprhdl, pdsRequired, child_index,
+								  pdrgpdpCtxt, ulOptReq);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalFullOuterHashJoin::Edm
+//
+//	@doc:
+//		Distribution matching type; a replicated child satisfies a hashed
+//		request, but must not feed a full join, so match exactly
+//
+//---------------------------------------------------------------------------
+CEnfdDistribution::EDistributionMatching
+CPhysicalFullOuterHashJoin::Edm(CReqdPropPlan *,	 // prppInput
+								ULONG,			 // child_index
+								CDrvdPropArray *,	 // pdrgpdpCtxt
+								ULONG			 // ulOptReq
+)
+{
+	return CEnfdDistribution::EdmExact;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalFullOuterHashJoin::PdsDerive
+//
+//	@doc:
+//		Derive distribution
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalFullOuterHashJoin::PdsDerive(CMemoryPool *mp,
+									  CExpressionHandle &exprhdl) const
+{
+	CDistributionSpec *pdsOuter = exprhdl.Pdpplan(0 /*child_index*/)->Pds();
+	CDistributionSpec *pdsInner = exprhdl.Pdpplan(1 /*child_index*/)->Pds();
+
+	if (CDistributionSpec::EdtHashed == pdsOuter->Edt() &&
+		CDistributionSpec::EdtHashed == pdsInner->Edt())
+	{
+		CDistributionSpecHashed *pdshashedOuter =
+			CDistributionSpecHashed::PdsConvert(pdsOuter);
+		CDistributionSpecHashed *pdshashedInner =
+			CDistributionSpecHashed::PdsConvert(pdsInner);
+
+		// null-extended rows of either child are not co-located with the
+		// NULL rows of the other child, similar to CPhysicalFullMergeJoin
+		pdshashedOuter->Pdrgpexpr()->AddRef();
+		CDistributionSpecHashed *pds = GPOS_NEW(mp) CDistributionSpecHashed(
+			pdshashedOuter->Pdrgpexpr(), false /* fNullsCollocated */);
+
+		if (pdshashedOuter->IsCoveredBy(PdrgpexprOuterKeys()) &&
+			pdshashedInner->IsCoveredBy(PdrgpexprInnerKeys()))
+		{
+			CDistributionSpecHashed *pdsCombined =
+				pds->Combine(mp, pdshashedInner);
+			pds->Release();
+			return pdsCombined;
+		}
+
+		return pds;
+	}
+
+	// otherwise both children execute on a single host
+	if (CDistributionSpec::EdtUniversal == pdsOuter->Edt())
+	{
+		pdsInner->AddRef();
+		return pdsInner;
+	}
+
+	pdsOuter->AddRef();
+	return pdsOuter;
+}
+
+// EOF
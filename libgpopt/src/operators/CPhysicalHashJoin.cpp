@@ -19,12 +19,15 @@
 #include "gpopt/base/CDistributionSpecHashed.h"
 #include "gpopt/base/CDistributionSpecSingleton.h"
 #include "gpopt/base/CPartIndexMap.h"
+#include "gpopt/base/CCostContext.h"
+#include "gpopt/base/COptimizationContext.h"
 
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPhysicalHashJoin.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarIdent.h"
 #include "gpopt/operators/CScalarConst.h"
+#include "gpopt/search/CGroupExpression.h"
 
 using namespace gpopt;
 
@@ -34,6 +37,9 @@ using namespace gpopt;
 // maximum number of redistribute requests on single hash join keys
 #define GPOPT_MAX_HASH_DIST_REQUESTS 6
 
+// maximum fraction of outer rows passing a runtime filter worth building
+#define GPOPT_RUNTIME_FILTER_MAX_SELECTIVITY 0.5
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalHashJoin::CPhysicalHashJoin
@@ -164,6 +170,156 @@ CPhysicalHashJoin::CreateHashRedistributeRequests(CMemoryPool *mp)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::DRuntimeFilterSelectivity
+//
+//	@doc:
+//		Estimate the fraction of outer rows passing a runtime filter built
+//		from the hash table; joins emitting unmatched outer rows cannot
+//		filter their outer child, and non-selective filters are not worth
+//		their build and probe overhead
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysicalHashJoin::DRuntimeFilterSelectivity(CDouble dRowsOuter,
+											 CDouble dRowsJoin) const
+{
+	switch (Eopid())
+	{
+		case EopPhysicalInnerHashJoin:
+		case EopPhysicalLeftSemiHashJoin:
+		case EopPhysicalRightOuterHashJoin:
+			break;
+
+		default:
+			return CDouble(1.0);
+	}
+
+	if (dRowsOuter <= CDouble(0.0))
+	{
+		return CDouble(1.0);
+	}
+
+	// every matching outer row produces at least one join row, so this
+	// never underestimates the fraction of outer rows passing the filter
+	CDouble dSelectivity = dRowsJoin / dRowsOuter;
+	if (CDouble(GPOPT_RUNTIME_FILTER_MAX_SELECTIVITY) < dSelectivity)
+	{
+		return CDouble(1.0);
+	}
+
+	return dSelectivity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::FCanPlaceRuntimeFilter
+//
+//	@doc:
+//		Check if a runtime filter built from the hash table can be applied by
+//		a table scan on the probe side; the filter is probed with the outer
+//		keys, so they must be plain columns of the scan. Both the cost model
+//		and the DXL translator use this check, so that only plans that get a
+//		filter are costed with one
+//
+//---------------------------------------------------------------------------
+BOOL
+CPhysicalHashJoin::FCanPlaceRuntimeFilter(CMemoryPool *mp,
+										  CExpressionHandle &exprhdl) const
+{
+	CColRefSet *pcrsKeys = GPOS_NEW(mp) CColRefSet(mp);
+	const ULONG ulKeys = m_pdrgpexprOuterKeys->Size();
+	for (ULONG ul = 0; ul < ulKeys; ul++)
+	{
+		COperator *popKey = (*m_pdrgpexprOuterKeys)[ul]->Pop();
+		if (COperator::EopScalarIdent != popKey->Eopid())
+		{
+			// the filter cannot be probed with computed keys
+			pcrsKeys->Release();
+			return false;
+		}
+		pcrsKeys->Include(CScalarIdent::PopConvert(popKey)->Pcr());
+	}
+
+	BOOL fResult = false;
+	CExpressionHandle exprhdlOuter(mp);
+	if (NULL != exprhdl.Pexpr())
+	{
+		exprhdlOuter.Attach((*exprhdl.Pexpr())[0]);
+		fResult = FRuntimeFilterKeysFromScan(mp, exprhdlOuter, pcrsKeys);
+	}
+	else if (NULL != exprhdl.Pcc())
+	{
+		COptimizationContext *pocOuter = (*exprhdl.Pcc()->Pdrgpoc())[0];
+		if (NULL != pocOuter && NULL != pocOuter->PccBest())
+		{
+			exprhdlOuter.Attach(pocOuter->PccBest());
+			fResult = FRuntimeFilterKeysFromScan(mp, exprhdlOuter, pcrsKeys);
+		}
+	}
+	pcrsKeys->Release();
+
+	return fResult;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::FRuntimeFilterKeysFromScan
+//
+//	@doc:
+//		Check if the probe side operator the handle is attached to passes on
+//		the given keys from a table scan; the search descends through
+//		filters, projections and the probe side of other hash joins, and
+//		stops at motions and at operators that combine or reorder rows
+//
+//---------------------------------------------------------------------------
+BOOL
+CPhysicalHashJoin::FRuntimeFilterKeysFromScan(CMemoryPool *mp,
+											  CExpressionHandle &exprhdl,
+											  CColRefSet *pcrsKeys)
+{
+	COperator *pop = NULL;
+	if (NULL != exprhdl.Pexpr())
+	{
+		pop = exprhdl.Pexpr()->Pop();
+	}
+	else
+	{
+		pop = exprhdl.Pgexpr()->Pop();
+	}
+
+	if (COperator::EopPhysicalTableScan == pop->Eopid())
+	{
+		return exprhdl.DeriveOutputColumns()->ContainsAll(pcrsKeys);
+	}
+
+	if (COperator::EopPhysicalFilter != pop->Eopid() &&
+		COperator::EopPhysicalComputeScalar != pop->Eopid() &&
+		!CUtils::FHashJoin(pop))
+	{
+		return false;
+	}
+
+	// the rows of the first child stream through the operator
+	CExpressionHandle exprhdlChild(mp);
+	if (NULL != exprhdl.Pexpr())
+	{
+		exprhdlChild.Attach((*exprhdl.Pexpr())[0]);
+	}
+	else
+	{
+		COptimizationContext *pocChild = (*exprhdl.Pcc()->Pdrgpoc())[0];
+		if (NULL == pocChild || NULL == pocChild->PccBest())
+		{
+			return false;
+		}
+		exprhdlChild.Attach(pocChild->PccBest());
+	}
+
+	return FRuntimeFilterKeysFromScan(mp, exprhdlChild, pcrsKeys);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalHashJoin::PosRequired
@@ -730,6 +886,53 @@ CPhysicalHashJoin::PdsRequired(
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::PdsRequiredNoBroadcast
+//
+//	@doc:
+//		Compute required distribution of the n-th child of a hash join that
+//		emits the unmatched rows of its inner child; the (hashed, broadcast)
+//		requests are not created, since every segment would emit the
+//		unmatched rows of the broadcast child:
+//		Req(1 to N) (redistribute, redistribute)
+//		Req(N + 1) (singleton, singleton)
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalHashJoin::PdsRequiredNoBroadcast(CMemoryPool *mp,
+										  CExpressionHandle &exprhdl,
+										  CDistributionSpec *pdsRequired,
+										  ULONG child_index,
+										  CDrvdPropArray *pdrgpdpCtxt,
+										  ULONG ulOptReq) const
+{
+	GPOS_ASSERT(2 > child_index);
+	GPOS_ASSERT(ulOptReq < UlDistrRequests());
+
+	// if expression has to execute on a single host then we need a gather
+	if (exprhdl.NeedsSingletonExecution() || exprhdl.HasOuterRefs())
+	{
+		return PdsRequireSingleton(mp, exprhdl, pdsRequired, child_index);
+	}
+
+	const ULONG ulHashDistributeRequests =
+		m_pdrgpdsRedistributeRequests->Size();
+	if (ulOptReq < ulHashDistributeRequests)
+	{
+		// requests 1 .. N are (redistribute, redistribute)
+		return CPhysicalHashJoin::PdsRequired(
+			mp, exprhdl, pdsRequired, child_index, pdrgpdpCtxt, ulOptReq);
+	}
+
+	GPOS_ASSERT(ulOptReq == ulHashDistributeRequests);
+
+	// request N + 1 is (singleton, singleton)
+	return PdsRequiredSingleton(mp, exprhdl, pdsRequired, child_index,
+								pdrgpdpCtxt);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalHashJoin::PdshashedRequired
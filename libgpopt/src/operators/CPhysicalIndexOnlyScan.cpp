@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalIndexOnlyScan.cpp
+//
+//	@doc:
+//		Implementation of index only scan operator
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CColRefSet.h"
+#include "gpopt/operators/CPhysicalIndexOnlyScan.h"
+
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIndexOnlyScan::CPhysicalIndexOnlyScan
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalIndexOnlyScan::CPhysicalIndexOnlyScan(
+	CMemoryPool *mp, CIndexDescriptor *pindexdesc, CTableDescriptor *ptabdesc,
+	ULONG ulOriginOpId, const CName *pnameAlias, CColRefArray *pdrgpcrOutput,
+	COrderSpec *pos, CColRefSet *pcrsIndexKeys)
+	: CPhysicalIndexScan(mp, pindexdesc, ptabdesc, ulOriginOpId, pnameAlias,
+						 pdrgpcrOutput, pos),
+	  m_pcrsIndexKeys(pcrsIndexKeys)
+{
+	GPOS_ASSERT(NULL != pcrsIndexKeys);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIndexOnlyScan::~CPhysicalIndexOnlyScan
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalIndexOnlyScan::~CPhysicalIndexOnlyScan()
+{
+	m_pcrsIndexKeys->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIndexOnlyScan::FProvidesReqdCols
+//
+//	@doc:
+//		Check if required columns are stored in the index; the heap is never
+//		visited, so any other column prunes this alternative
+//
+//---------------------------------------------------------------------------
+BOOL
+CPhysicalIndexOnlyScan::FProvidesReqdCols(CExpressionHandle &,	// exprhdl
+										  CColRefSet *pcrsRequired,
+										  ULONG	 // ulOptReq
+) const
+{
+	GPOS_ASSERT(NULL != pcrsRequired);
+
+	return m_pcrsIndexKeys->ContainsAll(pcrsRequired);
+}
+
+// EOF
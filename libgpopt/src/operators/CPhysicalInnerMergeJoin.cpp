@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalInnerMergeJoin.cpp
+//
+//	@doc:
+//		Implementation of inner merge join operator
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpopt/base/CDistributionSpecHashed.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalInnerMergeJoin.h"
+
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerMergeJoin::CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalInnerMergeJoin::CPhysicalInnerMergeJoin(
+	CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+	CExpressionArray *inner_merge_clauses)
+	: CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses)
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerMergeJoin::~CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalInnerMergeJoin::~CPhysicalInnerMergeJoin()
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerMergeJoin::PdsDerive
+//
+//	@doc:
+//		Derive distribution; joined rows agree on the merge clauses, so the
+//		output is distributed like either of the co-located children
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalInnerMergeJoin::PdsDerive(CMemoryPool *mp,
+								   CExpressionHandle &exprhdl) const
+{
+	CDistributionSpec *pdsOuter = exprhdl.Pdpplan(0 /*child_index*/)->Pds();
+	CDistributionSpec *pdsInner = exprhdl.Pdpplan(1 /*child_index*/)->Pds();
+
+	if (CDistributionSpec::EdtHashed == pdsOuter->Edt() &&
+		CDistributionSpec::EdtHashed == pdsInner->Edt())
+	{
+		CDistributionSpecHashed *pdshashedOuter =
+			CDistributionSpecHashed::PdsConvert(pdsOuter);
+		CDistributionSpecHashed *pdshashedInner =
+			CDistributionSpecHashed::PdsConvert(pdsInner);
+
+		if (pdshashedOuter->IsCoveredBy(PdrgpexprOuterMergeClauses()) &&
+			pdshashedInner->IsCoveredBy(PdrgpexprInnerMergeClauses()))
+		{
+			return pdshashedOuter->Combine(mp, pdshashedInner);
+		}
+	}
+
+	return CPhysicalJoin::PdsDerive(mp, exprhdl);
+}
+
+
+// EOF
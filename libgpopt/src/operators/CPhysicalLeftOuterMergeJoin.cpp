@@ -0,0 +1,48 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalLeftOuterMergeJoin.cpp
+//
+//	@doc:
+//		Implementation of left outer merge join operator
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpopt/operators/CPhysicalLeftOuterMergeJoin.h"
+
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalLeftOuterMergeJoin::CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalLeftOuterMergeJoin::CPhysicalLeftOuterMergeJoin(
+	CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+	CExpressionArray *inner_merge_clauses)
+	: CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses)
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalLeftOuterMergeJoin::~CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalLeftOuterMergeJoin::~CPhysicalLeftOuterMergeJoin()
+{
+}
+
+
+// EOF
@@ -0,0 +1,140 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CPhysicalRightOuterHashJoin.cpp
+//
+//	@doc:
+//		Implementation of right outer hash join operator
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpopt/base/CDistributionSpecHashed.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalRightOuterHashJoin.h"
+
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalRightOuterHashJoin::CPhysicalRightOuterHashJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalRightOuterHashJoin::CPhysicalRightOuterHashJoin(
+	CMemoryPool *mp, CExpressionArray *pdrgpexprOuterKeys,
+	CExpressionArray *pdrgpexprInnerKeys)
+	: CPhysicalHashJoin(mp, pdrgpexprOuterKeys, pdrgpexprInnerKeys)
+{
+	// Req(1 to N) (redistribute, redistribute)
+	// Req(N + 1) (singleton, singleton)
+	SetDistrRequests(UlHashDistributeRequests() + 1);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalRightOuterHashJoin::~CPhysicalRightOuterHashJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalRightOuterHashJoin::~CPhysicalRightOuterHashJoin()
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalRightOuterHashJoin::PdsRequired
+//
+//	@doc:
+//		Compute required distribution of the n-th child
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalRightOuterHashJoin::PdsRequired(CMemoryPool *mp,
+										 CExpressionHandle &exprhdl,
+										 CDistributionSpec *pdsRequired,
+										 ULONG child_index,
+										 CDrvdPropArray *pdrgpdpCtxt,
+										 ULONG ulOptReq) const
+{
+	return PdsRequiredNoBroadcast(mp, exprhdl, pdsRequired, child_index,
+								  pdrgpdpCtxt, ulOptReq);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalRightOuterHashJoin::Edm
+//
+//	@doc:
+//		Distribution matching type; a replicated inner child satisfies a
+//		hashed request, but its unmatched rows would be emitted by every
+//		segment, so the inner child is matched exactly
+//
+//---------------------------------------------------------------------------
+CEnfdDistribution::EDistributionMatching
+CPhysicalRightOuterHashJoin::Edm(CReqdPropPlan *prppInput, ULONG child_index,
+								 CDrvdPropArray *pdrgpdpCtxt, ULONG ulOptReq)
+{
+	if (1 == child_index)
+	{
+		return CEnfdDistribution::EdmExact;
+	}
+
+	return CPhysicalHashJoin::Edm(prppInput, child_index, pdrgpdpCtxt,
+								  ulOptReq);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalRightOuterHashJoin::PdsDerive
+//
+//	@doc:
+//		Derive distribution; rows of the outer child are null-extended, so
+//		the join is distributed like its inner child
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalRightOuterHashJoin::PdsDerive(CMemoryPool *mp,
+									   CExpressionHandle &exprhdl) const
+{
+	CDistributionSpec *pdsOuter = exprhdl.Pdpplan(0 /*child_index*/)->Pds();
+	CDistributionSpec *pdsInner = exprhdl.Pdpplan(1 /*child_index*/)->Pds();
+
+	CDistributionSpec *pds = pdsInner;
+	if (CDistributionSpec::EdtUniversal == pdsInner->Edt())
+	{
+		// if inner is universal, return outer distribution
+		pds = pdsOuter;
+	}
+
+	if (CDistributionSpec::EdtHashed == pds->Edt())
+	{
+		CDistributionSpecHashed *pdsHashed =
+			CDistributionSpecHashed::PdsConvert(pds);
+
+		// clean up any incomplete distribution specs, as in CPhysicalJoin
+		if (!pdsHashed->HasCompleteEquivSpec(mp))
+		{
+			CExpressionArray *pdrgpexpr = pdsHashed->Pdrgpexpr();
+			pdrgpexpr->AddRef();
+			return GPOS_NEW(mp) CDistributionSpecHashed(
+				pdrgpexpr, pdsHashed->FNullsColocated());
+		}
+	}
+
+	pds->AddRef();
+	return pds;
+}
+
+// EOF
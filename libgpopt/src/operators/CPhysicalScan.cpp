@@ -154,6 +154,7 @@ CPhysicalScan::PdsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const
 {
 	BOOL fIndexOrBitmapScan =
 		COperator::EopPhysicalIndexScan == Eopid() ||
+		COperator::EopPhysicalIndexOnlyScan == Eopid() ||
 		COperator::EopPhysicalBitmapTableScan == Eopid() ||
 		COperator::EopPhysicalDynamicIndexScan == Eopid() ||
 		COperator::EopPhysicalDynamicBitmapTableScan == Eopid();
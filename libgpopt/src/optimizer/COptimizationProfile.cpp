@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		COptimizationProfile.cpp
+//
+//	@doc:
+//		Implementation of optimization phase timing
+//---------------------------------------------------------------------------
+
+#include "gpopt/optimizer/COptimizationProfile.h"
+
+using namespace gpopt;
+
+// names of optimization phases
+static const CHAR *rgszPhase[COptimizationProfile::EphSentinel] = {
+	"translate_query",
+	"preprocess",
+	"search",
+	"translate_plan",
+};
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::COptimizationProfile
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+COptimizationProfile::COptimizationProfile(CMemoryPool *mp)
+	: m_mp(mp), m_pdrgpulStageTime(NULL)
+{
+	m_pdrgpulStageTime = GPOS_NEW(mp) ULongPtrArray(mp);
+	Reset();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::~COptimizationProfile
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+COptimizationProfile::~COptimizationProfile()
+{
+	m_pdrgpulStageTime->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::StopPhase
+//
+//	@doc:
+//		Add the time elapsed since the last phase started to the given
+//		phase, and start timing the next one
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::StopPhase(EPhase eph)
+{
+	GPOS_ASSERT(EphSentinel > eph);
+
+	m_rgulPhaseTime[eph] += m_clock.ElapsedUS();
+	m_clock.Restart();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordSearchStage
+//
+//	@doc:
+//		Add the time spent in the given search stage
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordSearchStage(ULONG ulStage, ULONG ulTime)
+{
+	while (m_pdrgpulStageTime->Size() <= ulStage)
+	{
+		m_pdrgpulStageTime->Append(GPOS_NEW(m_mp) ULONG(0));
+	}
+
+	*(*m_pdrgpulStageTime)[ulStage] += ulTime;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::Reset
+//
+//	@doc:
+//		Reset all measurements
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::Reset()
+{
+	for (ULONG ul = 0; ul < EphSentinel; ul++)
+	{
+		m_rgulPhaseTime[ul] = 0;
+	}
+
+	m_pdrgpulStageTime->Clear();
+	m_clock.Restart();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::SzPhase
+//
+//	@doc:
+//		Name of the given phase
+//
+//---------------------------------------------------------------------------
+const CHAR *
+COptimizationProfile::SzPhase(EPhase eph)
+{
+	GPOS_ASSERT(EphSentinel > eph);
+
+	return rgszPhase[eph];
+}
+
+// EOF
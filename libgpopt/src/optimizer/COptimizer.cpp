@@ -35,7 +35,9 @@
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
 #include "gpopt/translate/CTranslatorExprToDXL.h"
+#include "gpopt/xforms/CXformStats.h"
 
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/optimizer/COptimizer.h"
 #include "gpopt/cost/ICostModel.h"
@@ -233,7 +235,8 @@ COptimizer::PdxlnOptimize(
 	ULONG ulHosts,	// actual number of data nodes in the system
 	ULONG ulSessionId, ULONG ulCmdId, CSearchStageArray *search_stage_array,
 	COptimizerConfig *optimizer_config,
-	const CHAR *szMinidumpFileName	// name of minidump file to be created
+	const CHAR *szMinidumpFileName,	 // name of minidump file to be created
+	COptimizationProfile *pprofile	 // collects time spent in each phase
 )
 {
 	GPOS_ASSERT(NULL != md_accessor);
@@ -265,6 +268,13 @@ COptimizer::PdxlnOptimize(
 
 		mdmp.Init(osMinidump.Value());
 	}
+	// xform statistics are only shared by the queries of a session
+	if (GPOS_FTRACE(EopttraceRecordXformStats) ||
+		GPOS_FTRACE(EopttraceXformStatsGuidedSearch))
+	{
+		CXformStats::Pxfstats()->StartQuery(ulSessionId);
+	}
+
 	CDXLNode *pdxlnPlan = NULL;
 	CErrorHandlerStandard errhdl;
 	GPOS_TRY_HDL(&errhdl)
@@ -285,6 +295,11 @@ COptimizer::PdxlnOptimize(
 			// install opt context in TLS
 			CAutoOptCtxt aoc(mp, md_accessor, pceeval, optimizer_config);
 
+			if (NULL != pprofile)
+			{
+				pprofile->StartPhase();
+			}
+
 			// translate DXL Tree -> Expr Tree
 			CTranslatorDXLToExpr dxltr(mp, md_accessor);
 			CExpression *pexprTranslated = dxltr.PexprTranslateQuery(
@@ -293,6 +308,11 @@ COptimizer::PdxlnOptimize(
 			gpdxl::ULongPtrArray *pdrgpul = dxltr.PdrgpulOutputColRefs();
 			gpmd::CMDNameArray *pdrgpmdname = dxltr.Pdrgpmdname();
 
+			if (NULL != pprofile)
+			{
+				pprofile->StopPhase(COptimizationProfile::EphTranslateQuery);
+			}
+
 			CQueryContext *pqc =
 				CQueryContext::PqcGenerate(mp, pexprTranslated, pdrgpul,
 										   pdrgpmdname, true /*fDeriveStats*/);
@@ -313,15 +333,32 @@ COptimizer::PdxlnOptimize(
 			}
 
 			GPOS_CHECK_ABORT;
+
+			if (NULL != pprofile)
+			{
+				pprofile->StopPhase(COptimizationProfile::EphPreprocess);
+			}
+
 			// optimize logical expression tree into physical expression tree.
-			CExpression *pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+			CExpression *pexprPlan =
+				PexprOptimize(mp, pqc, search_stage_array, pprofile);
 			GPOS_CHECK_ABORT;
 
+			if (NULL != pprofile)
+			{
+				pprofile->StopPhase(COptimizationProfile::EphSearch);
+			}
+
 			// translate plan into DXL
 			pdxlnPlan = CreateDXLNode(mp, md_accessor, pexprPlan,
 									  pqc->PdrgPcr(), pdrgpmdname, ulHosts);
 			GPOS_CHECK_ABORT;
 
+			if (NULL != pprofile)
+			{
+				pprofile->StopPhase(COptimizationProfile::EphTranslatePlan);
+			}
+
 			if (fMinidump)
 			{
 				CSerializablePlan serPlan(
@@ -414,10 +451,12 @@ COptimizer::CheckCTEConsistency(CMemoryPool *mp, CExpression *pexpr)
 //---------------------------------------------------------------------------
 CExpression *
 COptimizer::PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-						  CSearchStageArray *search_stage_array)
+						  CSearchStageArray *search_stage_array,
+						  COptimizationProfile *pprofile)
 {
 	CEngine eng(mp);
 	eng.Init(pqc, search_stage_array);
+	eng.SetProfile(pprofile);
 	eng.Optimize();
 
 	GPOS_CHECK_ABORT;
@@ -1936,6 +1936,39 @@ CGroup::ResetGroupJobQueues()
 	m_jqImplementation.Reset();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroup::UlReleaseDominatedContexts
+//
+//	@doc:
+//		Release the cost contexts of group expressions, including duplicates
+//		left over by group merges, that are not the best of their
+//		optimization context; optimization contexts are kept, since later
+//		stages look up the best context across all stages
+//
+//---------------------------------------------------------------------------
+ULONG
+CGroup::UlReleaseDominatedContexts()
+{
+	ULONG ulReleased = 0;
+
+	CGroupExpression *pgexpr = m_listGExprs.First();
+	while (NULL != pgexpr)
+	{
+		ulReleased += pgexpr->UlReleaseDominatedContexts();
+		pgexpr = m_listGExprs.Next(pgexpr);
+	}
+
+	pgexpr = m_listDupGExprs.First();
+	while (NULL != pgexpr)
+	{
+		ulReleased += pgexpr->UlReleaseDominatedContexts();
+		pgexpr = m_listDupGExprs.Next(pgexpr);
+	}
+
+	return ulReleased;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CGroup::PstatsCompute
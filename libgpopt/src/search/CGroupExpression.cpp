@@ -148,6 +148,60 @@ CGroupExpression::CleanupContexts()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::UlReleaseDominatedContexts
+//
+//	@doc:
+//		Release cost contexts that are not the best cost context of their
+//		optimization context. Optimization contexts are bound to a search
+//		stage and are not optimized again in later stages, which only look
+//		up their best cost contexts, so the remaining cost contexts of
+//		completed stages are never used again. Cached lower bounds of
+//		partial plans are dropped as well, since they hold on to child cost
+//		contexts; they are recomputed on demand.
+//
+//		Must not be called while optimization jobs are running.
+//
+//---------------------------------------------------------------------------
+ULONG
+CGroupExpression::UlReleaseDominatedContexts()
+{
+	ULONG ulReleased = 0;
+
+	ShtIter shtit(m_sht);
+	BOOL fRemoved = false;
+	while (fRemoved || shtit.Advance())
+	{
+		// after a removal, the iterator already points to the next context
+		fRemoved = false;
+		CCostContext *pcc = NULL;
+
+		// iter's accessor scope
+		{
+			ShtAccIter shtitacc(shtit);
+			pcc = shtitacc.Value();
+			if (NULL != pcc && pcc != pcc->Poc()->PccBest())
+			{
+				shtitacc.Remove(pcc);
+				fRemoved = true;
+			}
+		}
+
+		if (fRemoved)
+		{
+			pcc->Release();
+			ulReleased++;
+		}
+	}
+
+	m_ppartialplancostmap->Release();
+	m_ppartialplancostmap = GPOS_NEW(m_mp) PartialPlanToCostMap(m_mp);
+
+	return ulReleased;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CGroupExpression::Init
@@ -10,6 +10,7 @@
 //---------------------------------------------------------------------------
 
 #include "gpopt/search/CGroupExpression.h"
+#include "gpopt/engine/CEngine.h"
 #include "gpopt/operators/CLogical.h"
 #include "gpopt/search/CJobFactory.h"
 #include "gpopt/search/CJobGroupExpression.h"
@@ -18,6 +19,8 @@
 #include "gpopt/search/CScheduler.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "gpopt/xforms/CXformFactory.h"
+#include "gpopt/xforms/CXformStats.h"
+#include "naucrates/traceflags/traceflags.h"
 
 using namespace gpopt;
 
@@ -56,6 +59,22 @@ void
 CJobGroupExpression::ScheduleTransformations(CSchedulerContext *psc,
 											 CXformSet *xform_set)
 {
+	if (GPOS_FTRACE(EopttraceXformStatsGuidedSearch))
+	{
+		// schedule the most productive xforms last, so that they run first
+		CXform::EXformId rgexfid[CXform::ExfSentinel];
+		const ULONG size = CXformStats::Pxfstats()->UlSortByYield(
+			xform_set, m_pgexpr->Arity(),
+			psc->Peng()->FSkipUnproductiveXforms(), rgexfid);
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			CXform *pxform = CXformFactory::Pxff()->Pxf(rgexfid[ul]);
+			CJobTransformation::ScheduleJob(psc, m_pgexpr, pxform, this);
+		}
+
+		return;
+	}
+
 	// iterate on xforms
 	CXformSetIter xsi(*(xform_set));
 	while (xsi.Advance())
@@ -171,6 +171,13 @@ CJobGroupExpressionExploration::ScheduleApplicableTransformations(
 {
 	GPOS_ASSERT(!FXformsScheduled());
 
+	// exploration is cut short once the memory budget is exceeded
+	if (!psc->Peng()->FExplorationAllowed(m_pgexpr))
+	{
+		SetXformsScheduled();
+		return;
+	}
+
 	// get all applicable xforms
 	COperator *pop = m_pgexpr->Pop();
 	CXformSet *xform_set =
@@ -179,13 +186,71 @@ CJobGroupExpressionExploration::ScheduleApplicableTransformations(
 	// intersect them with required xforms and schedule jobs
 	xform_set->Intersection(CXformFactory::Pxff()->PxfsExploration());
 	xform_set->Intersection(psc->Peng()->PxfsCurrentStage());
-	ScheduleTransformations(psc, xform_set);
+	if (psc->Peng()->FExplorationRestricted())
+	{
+		ScheduleRestrictedTransformations(psc, xform_set);
+	}
+	else
+	{
+		ScheduleTransformations(psc, xform_set);
+	}
 	xform_set->Release();
 
 	SetXformsScheduled();
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJobGroupExpressionExploration::ScheduleRestrictedTransformations
+//
+//	@doc:
+//		Schedule transformation jobs after the memory budget or the deadline
+//		was exceeded. Jobs run in the reverse order of scheduling, so the
+//		join order expansions are scheduled last, from the most to the least
+//		expensive one. Once one of them made the group implementable, the
+//		engine skips the remaining ones
+//
+//---------------------------------------------------------------------------
+void
+CJobGroupExpressionExploration::ScheduleRestrictedTransformations(
+	CSchedulerContext *psc, CXformSet *xform_set)
+{
+	const CXform::EXformId rgexfidExpansions[] = {
+		CXform::ExfExpandNAryJoinDP,	  CXform::ExfExpandNAryJoinDPv2,
+		CXform::ExfExpandNAryJoinMinCard, CXform::ExfExpandNAryJoinGreedy,
+		CXform::ExfExpandNAryJoin,
+	};
+
+	CMemoryPool *mp = psc->GetGlobalMemoryPool();
+	CXformSet *pxfsExpansions = GPOS_NEW(mp) CXformSet(mp);
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgexfidExpansions); ul++)
+	{
+		(void) pxfsExpansions->ExchangeSet(rgexfidExpansions[ul]);
+	}
+
+	// other xforms, such as subquery unnesting, are scheduled first and run
+	// after the expansions
+	CXformSet *pxfsOthers = GPOS_NEW(mp) CXformSet(mp);
+	pxfsOthers->Union(xform_set);
+	pxfsOthers->Difference(pxfsExpansions);
+	ScheduleTransformations(psc, pxfsOthers);
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgexfidExpansions); ul++)
+	{
+		if (xform_set->Get(rgexfidExpansions[ul]))
+		{
+			CJobTransformation::ScheduleJob(
+				psc, m_pgexpr, CXformFactory::Pxff()->Pxf(rgexfidExpansions[ul]),
+				this);
+		}
+	}
+
+	pxfsOthers->Release();
+	pxfsExpansions->Release();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJobGroupExpressionExploration::ScheduleChildGroupsJobs
@@ -132,6 +132,12 @@ CJobTransformation::EevtTransform(CSchedulerContext *psc, CJob *pjOwner)
 	CGroupExpression *pgexpr = pjt->m_pgexpr;
 	CXform *pxform = pjt->m_xform;
 
+	// exploration is cut short once the memory budget is exceeded
+	if (pxform->FExploration() && !psc->Peng()->FExplorationAllowed(pgexpr))
+	{
+		return eevCompleted;
+	}
+
 	// insert transformation results to memo
 	CXformResult *pxfres = GPOS_NEW(pmpGlobal) CXformResult(pmpGlobal);
 	ULONG ulElapsedTime = 0;
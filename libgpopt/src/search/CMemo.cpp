@@ -698,6 +698,34 @@ CMemo::ResetGroupStates()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemo::UlCompact
+//
+//	@doc:
+//		Release cost contexts of completed search stages that are dominated
+//		by the best cost context of their optimization context, and return
+//		their number
+//
+//---------------------------------------------------------------------------
+ULONG
+CMemo::UlCompact()
+{
+	ULONG ulReleased = 0;
+	CGroup *pgroup = m_listGroups.PtFirst();
+
+	while (NULL != pgroup)
+	{
+		ulReleased += pgroup->UlReleaseDominatedContexts();
+		pgroup = m_listGroups.Next(pgroup);
+
+		GPOS_CHECK_ABORT;
+	}
+
+	return ulReleased;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemo::ResetStats
@@ -110,7 +110,6 @@ void
 CScheduler::ExecuteJobs(CSchedulerContext *psc)
 {
 	CJob *pj = NULL;
-	ULONG count = 0;
 
 	// keep retrieving jobs
 	while (NULL != (pj = PjRetrieve()))
@@ -162,11 +161,10 @@ CScheduler::ExecuteJobs(CSchedulerContext *psc)
 				GPOS_ASSERT(!"Invalid job execution result");
 		}
 
-		if (++count == OPT_SCHED_CFA)
-		{
-			GPOS_CHECK_ABORT;
-			count = 0;
-		}
+		// check for aborts after every job; a check is cheap compared to a
+		// job, while checking after a batch of jobs delays cancellation by
+		// the time taken by the whole batch
+		GPOS_CHECK_ABORT;
 	}
 }
 
@@ -77,7 +77,8 @@ CTranslatorExprToDXL::CTranslatorExprToDXL(CMemoryPool *mp,
 	  m_pdpplan(NULL),
 	  m_pcf(NULL),
 	  m_pdrgpiSegments(pdrgpiSegments),
-	  m_iMasterId(GPOPT_MASTER_SEGMENT_ID)
+	  m_iMasterId(GPOPT_MASTER_SEGMENT_ID),
+	  m_ulNextRuntimeFilterId(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != md_accessor);
@@ -220,6 +221,8 @@ CTranslatorExprToDXL::InitPhysicalTranslators()
 		 &gpopt::CTranslatorExprToDXL::PdxlnResult},
 		{COperator::EopPhysicalIndexScan,
 		 &gpopt::CTranslatorExprToDXL::PdxlnIndexScan},
+		{COperator::EopPhysicalIndexOnlyScan,
+		 &gpopt::CTranslatorExprToDXL::PdxlnIndexScan},
 		{COperator::EopPhysicalBitmapTableScan,
 		 &gpopt::CTranslatorExprToDXL::PdxlnBitmapTableScan},
 		{COperator::EopPhysicalComputeScalar,
@@ -268,6 +271,10 @@ CTranslatorExprToDXL::InitPhysicalTranslators()
 		 &gpopt::CTranslatorExprToDXL::PdxlnHashJoin},
 		{COperator::EopPhysicalLeftOuterHashJoin,
 		 &gpopt::CTranslatorExprToDXL::PdxlnHashJoin},
+		{COperator::EopPhysicalFullOuterHashJoin,
+		 &gpopt::CTranslatorExprToDXL::PdxlnHashJoin},
+		{COperator::EopPhysicalRightOuterHashJoin,
+		 &gpopt::CTranslatorExprToDXL::PdxlnHashJoin},
 		{COperator::EopPhysicalLeftSemiHashJoin,
 		 &gpopt::CTranslatorExprToDXL::PdxlnHashJoin},
 		{COperator::EopPhysicalLeftAntiSemiHashJoin,
@@ -317,6 +324,10 @@ CTranslatorExprToDXL::InitPhysicalTranslators()
 		 &gpopt::CTranslatorExprToDXL::PdxlnCTEConsumer},
 		{COperator::EopPhysicalFullMergeJoin,
 		 &gpopt::CTranslatorExprToDXL::PdxlnMergeJoin},
+		{COperator::EopPhysicalInnerMergeJoin,
+		 &gpopt::CTranslatorExprToDXL::PdxlnMergeJoin},
+		{COperator::EopPhysicalLeftOuterMergeJoin,
+		 &gpopt::CTranslatorExprToDXL::PdxlnMergeJoin},
 	};
 
 	const ULONG translators_mapping_len =
@@ -657,8 +668,17 @@ CTranslatorExprToDXL::PdxlnIndexScan(CExpression *pexprIndexScan,
 
 	// TODO: vrgahavan; we assume that the index are always forward access.
 	// create the physical index scan operator
-	CDXLPhysicalIndexScan *dxl_op = GPOS_NEW(m_mp) CDXLPhysicalIndexScan(
-		m_mp, table_descr, dxl_index_descr, EdxlisdForward);
+	CDXLPhysicalIndexScan *dxl_op = NULL;
+	if (COperator::EopPhysicalIndexOnlyScan == popIs->Eopid())
+	{
+		dxl_op = GPOS_NEW(m_mp) CDXLPhysicalIndexOnlyScan(
+			m_mp, table_descr, dxl_index_descr, EdxlisdForward);
+	}
+	else
+	{
+		dxl_op = GPOS_NEW(m_mp) CDXLPhysicalIndexScan(
+			m_mp, table_descr, dxl_index_descr, EdxlisdForward);
+	}
 	CDXLNode *pdxlnIndexScan = GPOS_NEW(m_mp) CDXLNode(m_mp, dxl_op);
 
 	// set properties
@@ -1421,11 +1441,12 @@ CTranslatorExprToDXL::PdxlnIndexScanWithInlinedCondition(
 
 	COperator::EOperatorId op_id = pexprIndexScan->Pop()->Eopid();
 	GPOS_ASSERT(COperator::EopPhysicalIndexScan == op_id ||
+				COperator::EopPhysicalIndexOnlyScan == op_id ||
 				COperator::EopPhysicalDynamicIndexScan == op_id);
 
 	// check if index is of type GiST
 	BOOL isGist = false;
-	if (COperator::EopPhysicalIndexScan == op_id)
+	if (COperator::EopPhysicalDynamicIndexScan != op_id)
 	{
 		CPhysicalIndexScan *indexScan =
 			CPhysicalIndexScan::PopConvert(pexprIndexScan->Pop());
@@ -1461,7 +1482,7 @@ CTranslatorExprToDXL::PdxlnIndexScanWithInlinedCondition(
 		CExpression *pexprNewIndexScan = GPOS_NEW(m_mp)
 			CExpression(m_mp, pexprIndexScan->Pop(), pexprIndexLookupCond,
 						pexprNewScalarCond);
-		if (COperator::EopPhysicalIndexScan == op_id)
+		if (COperator::EopPhysicalDynamicIndexScan != op_id)
 		{
 			pdxlnIndexScan =
 				PdxlnIndexScan(pexprNewIndexScan, colref_array, dxl_properties,
@@ -1487,7 +1508,7 @@ CTranslatorExprToDXL::PdxlnIndexScanWithInlinedCondition(
 	dxl_properties->Release();
 	ULONG ulNonGatherMotions = 0;
 	BOOL fDML = false;
-	if (COperator::EopPhysicalIndexScan == op_id)
+	if (COperator::EopPhysicalDynamicIndexScan != op_id)
 	{
 		return PdxlnIndexScan(pexprIndexScan, colref_array, pdrgpdsBaseTables,
 							  &ulNonGatherMotions, &fDML);
@@ -1572,6 +1593,7 @@ CTranslatorExprToDXL::PdxlnFromFilter(CExpression *pexprFilter,
 										 dxl_properties);
 		}
 		case COperator::EopPhysicalIndexScan:
+		case COperator::EopPhysicalIndexOnlyScan:
 		case COperator::EopPhysicalDynamicIndexScan:
 		{
 			dxl_properties->AddRef();
@@ -3906,6 +3928,14 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 			join_type = EdxljtFull;
 			break;
 
+		case COperator::EopPhysicalInnerMergeJoin:
+			join_type = EdxljtInner;
+			break;
+
+		case COperator::EopPhysicalLeftOuterMergeJoin:
+			join_type = EdxljtLeft;
+			break;
+
 		default:
 			GPOS_ASSERT(!"Invalid join type");
 	}
@@ -3923,13 +3953,23 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 
 	CExpressionArray *pdrgpexprPredicates =
 		CPredicateUtils::PdrgpexprConjuncts(m_mp, pexprScalar);
+	CExpressionArray *pdrgpexprRemainingPredicates =
+		GPOS_NEW(m_mp) CExpressionArray(m_mp);
 	const ULONG length = pdrgpexprPredicates->Size();
 	for (ULONG ul = 0; ul < length; ul++)
 	{
 		CExpression *pexprPred = (*pdrgpexprPredicates)[ul];
-		// At this point, they all better be merge joinable
-		GPOS_ASSERT(CPhysicalJoin::FMergeJoinCompatible(
-			pexprPred, pexprOuterChild, pexprInnerChild));
+		if (!CPhysicalJoin::FMergeJoinCompatible(pexprPred, pexprOuterChild,
+												 pexprInnerChild))
+		{
+			// full merge joins have no join filter, so all their conjuncts
+			// better be merge joinable
+			GPOS_ASSERT(EdxljtFull != join_type);
+			pexprPred->AddRef();
+			pdrgpexprRemainingPredicates->Append(pexprPred);
+			continue;
+		}
+
 		CExpression *pexprPredOuter = (*pexprPred)[0];
 		CExpression *pexprPredInner = (*pexprPred)[1];
 
@@ -3983,10 +4023,23 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 	CDXLPhysicalProperties *dxl_properties = GetProperties(pexprMJ);
 	pdxlnMJ->SetProperties(dxl_properties);
 
-	// construct an empty plan filter and join filter
+	// construct an empty plan filter, and a join filter from the conjuncts
+	// that are not merge clauses
 	CDXLNode *filter_dxlnode = PdxlnFilter(NULL);
 	CDXLNode *dxlnode_join_filter = GPOS_NEW(m_mp)
 		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarJoinFilter(m_mp));
+	if (0 < pdrgpexprRemainingPredicates->Size())
+	{
+		CExpression *pexprJoinCond = CPredicateUtils::PexprConjunction(
+			m_mp, pdrgpexprRemainingPredicates);
+		CDXLNode *pdxlnJoinCond = PdxlnScalar(pexprJoinCond);
+		dxlnode_join_filter->AddChild(pdxlnJoinCond);
+		pexprJoinCond->Release();
+	}
+	else
+	{
+		pdrgpexprRemainingPredicates->Release();
+	}
 
 	// add children
 	pdxlnMJ->AddChild(proj_list_dxlnode);
@@ -4023,6 +4076,12 @@ CTranslatorExprToDXL::EdxljtHashJoin(CPhysicalHashJoin *popHJ)
 		case COperator::EopPhysicalLeftOuterHashJoin:
 			return EdxljtLeft;
 
+		case COperator::EopPhysicalFullOuterHashJoin:
+			return EdxljtFull;
+
+		case COperator::EopPhysicalRightOuterHashJoin:
+			return EdxljtRight;
+
 		case COperator::EopPhysicalLeftSemiHashJoin:
 			return EdxljtIn;
 
@@ -4172,6 +4231,11 @@ CTranslatorExprToDXL::PdxlnHashJoin(CExpression *pexprHJ,
 	// cleanup
 	pdrgpexprPredicates->Release();
 
+	if (GPOS_FTRACE(EopttraceEnableRuntimeJoinFilters))
+	{
+		AddRuntimeFilter(pexprHJ, pdxlnHJ);
+	}
+
 #ifdef GPOS_DEBUG
 	pdxlopHJ->AssertValid(pdxlnHJ, false /* validate_children */);
 #endif
@@ -4179,6 +4243,132 @@ CTranslatorExprToDXL::PdxlnHashJoin(CExpression *pexprHJ,
 	return pdxlnHJ;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorExprToDXL::AddRuntimeFilter
+//
+//	@doc:
+//		Annotate a hash join with a runtime filter built from its hash table,
+//		if the join is estimated to discard most of its outer rows and the
+//		outer join keys are columns of a table scan on the probe side
+//
+//---------------------------------------------------------------------------
+void
+CTranslatorExprToDXL::AddRuntimeFilter(CExpression *pexprHJ, CDXLNode *pdxlnHJ)
+{
+	const IStatistics *stats = pexprHJ->Pstats();
+	const IStatistics *pstatsOuter = (*pexprHJ)[0]->Pstats();
+
+	// stats may not be present in artificially generated physical trees
+	if (NULL == stats || NULL == pstatsOuter)
+	{
+		return;
+	}
+
+	CPhysicalHashJoin *popHJ = CPhysicalHashJoin::PopConvert(pexprHJ->Pop());
+	CDouble dSelectivity =
+		popHJ->DRuntimeFilterSelectivity(pstatsOuter->Rows(), stats->Rows());
+	if (CDouble(1.0) <= dSelectivity)
+	{
+		return;
+	}
+
+	// same check as in costing the join
+	CExpressionHandle exprhdl(m_mp);
+	exprhdl.Attach(pexprHJ);
+	if (!popHJ->FCanPlaceRuntimeFilter(m_mp, exprhdl))
+	{
+		return;
+	}
+
+	// the outer keys are columns of the scan, find its DXL node
+	CColRefSet *pcrsKeys = GPOS_NEW(m_mp) CColRefSet(m_mp);
+	const CExpressionArray *pdrgpexprOuterKeys = popHJ->PdrgpexprOuterKeys();
+	const ULONG ulKeys = pdrgpexprOuterKeys->Size();
+	for (ULONG ul = 0; ul < ulKeys; ul++)
+	{
+		pcrsKeys->Include(
+			CScalarIdent::PopConvert((*pdrgpexprOuterKeys)[ul]->Pop())->Pcr());
+	}
+
+	CDXLNode *pdxlnScan =
+		PdxlnRuntimeFilterScan((*pdxlnHJ)[EdxlhjIndexHashLeft], pcrsKeys);
+	pcrsKeys->Release();
+
+	if (NULL != pdxlnScan)
+	{
+		CDXLPhysicalHashJoin::Cast(pdxlnHJ->GetOperator())
+			->SetRuntimeFilterId(m_ulNextRuntimeFilterId);
+		CDXLPhysicalTableScan::Cast(pdxlnScan->GetOperator())
+			->AddRuntimeFilterId(m_ulNextRuntimeFilterId);
+		m_ulNextRuntimeFilterId++;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorExprToDXL::PdxlnRuntimeFilterScan
+//
+//	@doc:
+//		Find the table scan producing the given keys below the probe side of
+//		a hash join; the hash join builds its hash table first, so the filter
+//		is complete before any operator in the same slice reads the scan
+//
+//---------------------------------------------------------------------------
+CDXLNode *
+CTranslatorExprToDXL::PdxlnRuntimeFilterScan(CDXLNode *dxlnode,
+											 CColRefSet *pcrsKeys)
+{
+	switch (dxlnode->GetOperator()->GetDXLOperator())
+	{
+		case EdxlopPhysicalTableScan:
+		{
+			// every key must be a column produced by the scan
+			CDXLNode *pdxlnPrL = (*dxlnode)[EdxltsIndexProjList];
+			const ULONG ulPrEls = pdxlnPrL->Arity();
+			CColRefSetIter crsi(*pcrsKeys);
+			while (crsi.Advance())
+			{
+				BOOL fFound = false;
+				for (ULONG ul = 0; !fFound && ul < ulPrEls; ul++)
+				{
+					CDXLScalarProjElem *pdxlopPrEl = CDXLScalarProjElem::Cast(
+						(*pdxlnPrL)[ul]->GetOperator());
+					fFound = (crsi.Pcr()->Id() == pdxlopPrEl->Id());
+				}
+
+				if (!fFound)
+				{
+					return NULL;
+				}
+			}
+
+			return dxlnode;
+		}
+
+		case EdxlopPhysicalResult:
+		{
+			// a result node filtering or projecting the rows of its child
+			if (EdxlresultIndexSentinel == dxlnode->Arity())
+			{
+				return PdxlnRuntimeFilterScan(
+					(*dxlnode)[EdxlresultIndexChild], pcrsKeys);
+			}
+			return NULL;
+		}
+
+		case EdxlopPhysicalHashJoin:
+			// the rows of the probe side stream through a hash join
+			return PdxlnRuntimeFilterScan((*dxlnode)[EdxlhjIndexHashLeft],
+										  pcrsKeys);
+
+		default:
+			// motions start a new slice, and the remaining operators either
+			// combine or reorder rows, so the filter is not pushed below them
+			return NULL;
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorExprToDXL::PdxlnMotion
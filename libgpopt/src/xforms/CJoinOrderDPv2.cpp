@@ -986,6 +986,10 @@ CJoinOrderDPv2::SearchJoinOrders(ULONG left_level, ULONG right_level)
 				continue;
 			}
 
+			// the number of pairs grows exponentially with the number of
+			// atoms, check for aborts for each of them
+			GPOS_CHECK_ABORT;
+
 			SExpressionProperties reqd_properties(EJoinOrderDP);
 			SExpressionInfo *join_expr_info = GetJoinExprForProperties(
 				left_group_info, right_group_info, reqd_properties);
@@ -1125,6 +1129,8 @@ CJoinOrderDPv2::GreedySearchJoinOrders(ULONG left_level, JoinOrderPropType algo)
 			continue;
 		}
 
+		GPOS_CHECK_ABORT;
+
 		SGroupAndExpression right_child_expr_info =
 			GetBestExprForProperties(right_group_info, right_reqd_properties);
 
@@ -84,15 +84,18 @@ CXformEagerAgg::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
 
 	CMemoryPool *mp = pxfctxt->Pmp();
 	CExpression *join_expr = (*agg_expr)[0];
-	CExpression *join_outer_child_expr = (*join_expr)[0];
-	CExpression *join_inner_child_expr = (*join_expr)[1];
-	CExpression *join_condition_expr = (*join_expr)[2];
 	CExpression *agg_proj_list_expr = (*agg_expr)[1];
+	const ULONG join_arity = join_expr->Arity();
+	CExpression *join_condition_expr = (*join_expr)[join_arity - 1];
+	const ULONG push_down_child_index = PushDownChildIndex(
+		join_expr, agg_proj_list_expr->DeriveUsedColumns());
+	GPOS_ASSERT(push_down_child_index < join_arity - 1);
+	CExpression *push_down_child_expr = (*join_expr)[push_down_child_index];
 
 	//	'push_down_gb_crs' represents the column references that are used for
 	//	grouping in the pushed-down aggregate. This is the union of the original
 	//	grouping columns and join predicate columns, retaining only the columns
-	//	from the outer child.
+	//	from the child the aggregate is pushed to.
 	// Example:
 	//	Input query: SELECT min(a1) FROM t1, t2 WHERE t1.j1 = t2.j2 GROUP BY t1.g1;
 	//	Convert to:
@@ -108,9 +111,9 @@ CXformEagerAgg::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
 		(CLogicalGbAgg::PopConvert(agg_expr->Pop()))->PcrsLocalUsed();
 	push_down_gb_cols->Union(grouping_cols);
 
-	/* only keep columns from outer child in the new grouping col set */
-	CColRefSet *outer_child_cols = join_outer_child_expr->DeriveOutputColumns();
-	push_down_gb_cols->Intersection(outer_child_cols);
+	/* only keep columns from the push down child in the new grouping col set */
+	push_down_gb_cols->Intersection(
+		push_down_child_expr->DeriveOutputColumns());
 
 	/* create new project lists for the two new Gb aggregates */
 	CExpression *lower_expr_proj_list = NULL;
@@ -122,21 +125,30 @@ CXformEagerAgg::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
 
 	// lower expression as a local aggregate
 	CColRefArray *push_down_gb_col_array = push_down_gb_cols->Pdrgpcr(mp);
-	join_outer_child_expr->AddRef();
+	push_down_child_expr->AddRef();
 	CExpression *lower_agg_expr = GPOS_NEW(mp)
 		CExpression(mp,
 					GPOS_NEW(mp) CLogicalGbAgg(mp, push_down_gb_col_array,
 											   COperator::EgbaggtypeLocal),
-					join_outer_child_expr, lower_expr_proj_list);
+					push_down_child_expr, lower_expr_proj_list);
 
-	// join expression
+	// join expression, with the lower aggregate replacing its child
+	CExpressionArray *join_child_array = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < join_arity; ul++)
+	{
+		if (push_down_child_index == ul)
+		{
+			join_child_array->Append(lower_agg_expr);
+			continue;
+		}
+		CExpression *join_child_expr = (*join_expr)[ul];
+		join_child_expr->AddRef();
+		join_child_array->Append(join_child_expr);
+	}
 	COperator *join_op = join_expr->Pop();
 	join_op->AddRef();
-	join_inner_child_expr->AddRef();
-	join_condition_expr->AddRef();
 	CExpression *new_join_expr =
-		GPOS_NEW(mp) CExpression(mp, join_op, lower_agg_expr,
-								 join_inner_child_expr, join_condition_expr);
+		GPOS_NEW(mp) CExpression(mp, join_op, join_child_array);
 
 	// upper expression as a global aggregate
 	CColRefArray *grouping_col_array = grouping_cols->Pdrgpcr(mp);
@@ -149,19 +161,32 @@ CXformEagerAgg::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
 	pxfres->Add(upper_agg_expr);
 }
 
+// index of the join child producing all columns used by the aggregates;
+// the aggregate is only pushed down on the outer child (the inner child
+// alternative is explored through commutativity)
+ULONG
+CXformEagerAgg::PushDownChildIndex(CExpression *join_expr,
+								   CColRefSet *agg_cols) const
+{
+	if ((*join_expr)[0]->DeriveOutputColumns()->ContainsAll(agg_cols))
+	{
+		return 0;
+	}
+
+	return gpos::ulong_max;
+}
+
 // check if an aggregate can be pushed below a join
 // Only following aggregates are supported:
 // 	min, max, sum, count, avg
+// or, with generalized eager aggregation, any aggregate with a combine
+// function, since combining duplicated partial results gives the same
+// result as aggregating the duplicated join rows
 BOOL
 CXformEagerAgg::CanPushAggBelowJoin(CExpression *scalar_agg_func_expr) const
 {
 	CScalarAggFunc *scalar_agg_func =
 		CScalarAggFunc::PopConvert(scalar_agg_func_expr->Pop());
-	if (scalar_agg_func_expr->Arity() != 1)
-	{
-		/* currently only supporting single-input aggregates */
-		return false;
-	}
 
 	// not supporting DQA
 	if (scalar_agg_func->IsDistinct())
@@ -173,6 +198,19 @@ CXformEagerAgg::CanPushAggBelowJoin(CExpression *scalar_agg_func_expr) const
 	CMDAccessor *md_accessor = poctxt->Pmda();
 	IMDId *agg_mdid =
 		scalar_agg_func->MDId();  // oid of the original aggregate function
+
+	if (GPOS_FTRACE(EopttraceEnableGeneralizedEagerAgg))
+	{
+		const IMDAggregate *md_agg = md_accessor->RetrieveAgg(agg_mdid);
+		return md_agg->IsSplittable() && !md_agg->IsOrdered();
+	}
+
+	if (scalar_agg_func_expr->Arity() != 1)
+	{
+		/* currently only supporting single-input aggregates */
+		return false;
+	}
+
 	CExpression *agg_child_expr = (*scalar_agg_func_expr)[0];
 	IMDId *agg_child_mdid =
 		CScalar::PopConvert(agg_child_expr->Pop())->MdidType();
@@ -197,26 +235,20 @@ CXformEagerAgg::CanPushAggBelowJoin(CExpression *scalar_agg_func_expr) const
 
 // Check if the transform can be applied
 //	 Eager agg is currently applied only if following is true:
-//		- Inner join of two relations
-//		- Single aggregate (MIN or MAX)
+//		- Join child producing all aggregate inputs exists
+//		- Aggregates are supported (see CanPushAggBelowJoin)
 //		- Aggregate is not a DQA
-//		- Single expression input in the agg
-//		- Input expression only part of outer child
 BOOL
 CXformEagerAgg::CanApplyTransform(CExpression *gb_agg_expr) const
 {
 	CExpression *join_expr = (*gb_agg_expr)[0];
 	CExpression *agg_proj_list_expr = (*gb_agg_expr)[1];
-	CExpression *join_outer_child_expr = (*join_expr)[0];
 
-	// currently only supporting aggregate column references from outer child
-	CColRefSet *join_outer_child_cols =
-		join_outer_child_expr->DeriveOutputColumns();
-	CColRefSet *agg_proj_list_cols = agg_proj_list_expr->DeriveUsedColumns();
-	if (!join_outer_child_cols->ContainsAll(agg_proj_list_cols))
+	// all columns used by the Gb aggregate should only be present in one
+	// child since we only support pushing down to one of children
+	if (gpos::ulong_max ==
+		PushDownChildIndex(join_expr, agg_proj_list_expr->DeriveUsedColumns()))
 	{
-		// all columns used by the Gb aggregate should only be present in outer
-		// child since we only support pushing down to one of children
 		return false;
 	}
 
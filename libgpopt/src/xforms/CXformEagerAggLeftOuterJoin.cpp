@@ -0,0 +1,52 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformEagerAggLeftOuterJoin.cpp
+//
+//	@doc:
+//		Implementation for eagerly pushing aggregates below the outer child
+//		of a left outer join
+//---------------------------------------------------------------------------
+#include "gpos/base.h"
+
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformEagerAggLeftOuterJoin.h"
+
+using namespace gpopt;
+
+// ctor
+CXformEagerAggLeftOuterJoin::CXformEagerAggLeftOuterJoin(CMemoryPool *mp)
+	: CXformEagerAgg(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalGbAgg(mp),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CLogicalLeftOuterJoin(mp),
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // join outer child
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // join inner child
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternTree(mp))  // join predicate
+				  ),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CPatternTree(mp))  // scalar project list
+			  ))
+{
+}
+
+// compute xform promise for a given expression handle
+CXform::EXformPromise
+CXformEagerAggLeftOuterJoin::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (GPOS_FTRACE(EopttraceEnableGeneralizedEagerAgg) &&
+		CLogicalGbAgg::PopConvert(exprhdl.Pop())->FGlobal())
+	{
+		return CXform::ExfpHigh;
+	}
+	return CXform::ExfpNone;
+}
+
+// EOF
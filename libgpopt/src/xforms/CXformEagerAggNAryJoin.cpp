@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformEagerAggNAryJoin.cpp
+//
+//	@doc:
+//		Implementation for eagerly pushing aggregates below an n-ary join
+//---------------------------------------------------------------------------
+#include "gpos/base.h"
+
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformEagerAggNAryJoin.h"
+
+using namespace gpopt;
+
+// ctor
+CXformEagerAggNAryJoin::CXformEagerAggNAryJoin(CMemoryPool *mp)
+	: CXformEagerAgg(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalGbAgg(mp),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CLogicalNAryJoin(mp),
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternMultiLeaf(mp)),	// join children
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternTree(mp))  // join predicate
+				  ),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CPatternTree(mp))  // scalar project list
+			  ))
+{
+}
+
+// compute xform promise for a given expression handle
+CXform::EXformPromise
+CXformEagerAggNAryJoin::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (GPOS_FTRACE(EopttraceEnableGeneralizedEagerAgg) &&
+		CLogicalGbAgg::PopConvert(exprhdl.Pop())->FGlobal())
+	{
+		return CXform::ExfpHigh;
+	}
+	return CXform::ExfpNone;
+}
+
+// index of the first join child producing all columns used by the
+// aggregates; rows of the inner child of a left outer join may be
+// null-extended, so the aggregate cannot be pushed below it
+ULONG
+CXformEagerAggNAryJoin::PushDownChildIndex(CExpression *join_expr,
+										   CColRefSet *agg_cols) const
+{
+	CLogicalNAryJoin *nary_join_op =
+		CLogicalNAryJoin::PopConvert(join_expr->Pop());
+	const ULONG num_children = join_expr->Arity() - 1;
+	for (ULONG ul = 0; ul < num_children; ul++)
+	{
+		if (nary_join_op->IsInnerJoinChild(ul) &&
+			(*join_expr)[ul]->DeriveOutputColumns()->ContainsAll(agg_cols))
+		{
+			return ul;
+		}
+	}
+
+	return gpos::ulong_max;
+}
+
+// EOF
@@ -301,6 +301,17 @@ CXformFactory::Instantiate()
 				m_mp));
 	Add(GPOS_NEW(m_mp)
 			CXformLeftOuterJoinWithInnerSelect2DynamicIndexGetApply(m_mp));
+	Add(GPOS_NEW(m_mp) CXformIndexGet2IndexOnlyScan(m_mp));
+	Add(GPOS_NEW(m_mp) CXformImplementFullOuterHashJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformRightOuterJoin2HashJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformEagerAggNAryJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformEagerAggLeftOuterJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformInnerJoinSemiJoinReducer(m_mp));
+	Add(GPOS_NEW(m_mp) CXformInnerJoin2MergeJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformLeftOuterJoin2MergeJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformPushLimitBelowUnionAll(m_mp));
+	Add(GPOS_NEW(m_mp) CXformPushLimitBelowLeftOuterJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformLeftOuterJoin2RightOuterJoin(m_mp));
 
 	GPOS_ASSERT(NULL != m_rgpxf[CXform::ExfSentinel - 1] &&
 				"Not all xforms have been instantiated");
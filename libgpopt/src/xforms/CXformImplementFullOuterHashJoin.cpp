@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformImplementFullOuterHashJoin.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CCastUtils.h"
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformImplementFullOuterHashJoin.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformImplementFullOuterHashJoin::CXformImplementFullOuterHashJoin
+//
+//	@doc:
+//		ctor
+//
+//---------------------------------------------------------------------------
+CXformImplementFullOuterHashJoin::CXformImplementFullOuterHashJoin(
+	CMemoryPool *mp)
+	:  // pattern
+	  CXformImplementation(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalFullOuterJoin(mp),
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // right child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate
+		  ))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformImplementFullOuterHashJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle;
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformImplementFullOuterHashJoin::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableFullOuterHashJoin))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXformUtils::ExfpLogicalJoin2PhysicalJoin(exprhdl);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformImplementFullOuterHashJoin::Transform
+//
+//	@doc:
+//		actual transformation; unlike the other hash joins, a full hash join
+//		cannot evaluate conjuncts that are not hash join keys, since such a
+//		conjunct decides which rows are unmatched
+//
+//---------------------------------------------------------------------------
+void
+CXformImplementFullOuterHashJoin::Transform(CXformContext *pxfctxt,
+											CXformResult *pxfres,
+											CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+	CExpression *pexprOuter = (*pexpr)[0];
+	CExpression *pexprInner = (*pexpr)[1];
+
+	CExpressionArray *pdrgpexpr =
+		CCastUtils::PdrgpexprCastEquality(mp, (*pexpr)[2]);
+	const ULONG ulPreds = pdrgpexpr->Size();
+	BOOL fHashJoinable = (0 < ulPreds);
+	for (ULONG ul = 0; fHashJoinable && ul < ulPreds; ul++)
+	{
+		fHashJoinable = CPhysicalJoin::FHashJoinCompatible(
+			(*pdrgpexpr)[ul], pexprOuter, pexprInner);
+	}
+	pdrgpexpr->Release();
+
+	if (!fHashJoinable)
+	{
+		return;
+	}
+
+	CXformUtils::ImplementHashJoin<CPhysicalFullOuterHashJoin>(pxfctxt, pxfres,
+															   pexpr);
+}
+
+
+// EOF
@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformIndexGet2IndexOnlyScan.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpopt/xforms/CXformIndexGet2IndexOnlyScan.h"
+
+#include "gpopt/operators/ops.h"
+#include "gpopt/metadata/CIndexDescriptor.h"
+#include "gpopt/metadata/CTableDescriptor.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformIndexGet2IndexOnlyScan::CXformIndexGet2IndexOnlyScan
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformIndexGet2IndexOnlyScan::CXformIndexGet2IndexOnlyScan(CMemoryPool *mp)
+	:  // pattern
+	  CXformImplementation(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalIndexGet(mp),
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CPatternLeaf(mp))  // index lookup predicate
+		  ))
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformIndexGet2IndexOnlyScan::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle; only btree
+//		indexes on heap tables return their key columns
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformIndexGet2IndexOnlyScan::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableIndexOnlyScan))
+	{
+		return CXform::ExfpNone;
+	}
+
+	CLogicalIndexGet *popGet = CLogicalIndexGet::PopConvert(exprhdl.Pop());
+
+	CTableDescriptor *ptabdesc = popGet->Ptabdesc();
+	CIndexDescriptor *pindexdesc = popGet->Pindexdesc();
+
+	if (pindexdesc->IndexType() != IMDIndex::EmdindBtree ||
+		ptabdesc->IsAORowOrColTable())
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformIndexGet2IndexOnlyScan::Transform
+//
+//	@doc:
+//		Actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformIndexGet2IndexOnlyScan::Transform(CXformContext *pxfctxt,
+										CXformResult *pxfres,
+										CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CLogicalIndexGet *pop = CLogicalIndexGet::PopConvert(pexpr->Pop());
+	CMemoryPool *mp = pxfctxt->Pmp();
+	CIndexDescriptor *pindexdesc = pop->Pindexdesc();
+	CTableDescriptor *ptabdesc = pop->Ptabdesc();
+
+	// extract components
+	CExpression *pexprIndexCond = (*pexpr)[0];
+	if (pexprIndexCond->DeriveHasSubquery())
+	{
+		return;
+	}
+
+	CColRefArray *pdrgpcrOutput = pop->PdrgpcrOutput();
+	GPOS_ASSERT(NULL != pdrgpcrOutput);
+
+	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+	const IMDRelation *pmdrel = md_accessor->RetrieveRel(ptabdesc->MDId());
+	const IMDIndex *pmdindex = md_accessor->RetrieveIndex(pindexdesc->MDId());
+
+	// the included columns of an index are fetched from the heap, so only
+	// the key columns can be returned from the index itself
+	CColRefSet *pcrsIndexKeys =
+		CXformUtils::PcrsIndexKeys(mp, pdrgpcrOutput, pmdindex, pmdrel);
+
+	// the lookup condition must not need any column of the heap tuple
+	CColRefSet *pcrsCond = GPOS_NEW(mp) CColRefSet(mp);
+	pcrsCond->Include(pexprIndexCond->DeriveUsedColumns());
+	pcrsCond->Intersection(pexpr->DeriveOutputColumns());
+	BOOL fCovered = pcrsIndexKeys->ContainsAll(pcrsCond);
+	pcrsCond->Release();
+
+	if (!fCovered)
+	{
+		pcrsIndexKeys->Release();
+		return;
+	}
+
+	pindexdesc->AddRef();
+	ptabdesc->AddRef();
+	pdrgpcrOutput->AddRef();
+
+	COrderSpec *pos = pop->Pos();
+	GPOS_ASSERT(NULL != pos);
+	pos->AddRef();
+
+	// addref all children
+	pexprIndexCond->AddRef();
+
+	CExpression *pexprAlt = GPOS_NEW(mp) CExpression(
+		mp,
+		GPOS_NEW(mp) CPhysicalIndexOnlyScan(
+			mp, pindexdesc, ptabdesc, pexpr->Pop()->UlOpId(),
+			GPOS_NEW(mp) CName(mp, pop->NameAlias()), pdrgpcrOutput, pos,
+			pcrsIndexKeys),
+		pexprIndexCond);
+	pxfres->Add(pexprAlt);
+}
+
+
+// EOF
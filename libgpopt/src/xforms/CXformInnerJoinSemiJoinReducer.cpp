@@ -0,0 +1,309 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformInnerJoinSemiJoinReducer.cpp
+//
+//	@doc:
+//		Implementation of inner join semi join reducer xform
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformInnerJoinSemiJoinReducer.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+// if ratio of the cardinalities inner/outer is below this value, we apply
+// the xform
+const DOUBLE CXformInnerJoinSemiJoinReducer::m_dInnerOuterRatioThreshold =
+	0.01;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoinSemiJoinReducer::CXformInnerJoinSemiJoinReducer
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformInnerJoinSemiJoinReducer::CXformInnerJoinSemiJoinReducer(
+	CMemoryPool *mp)
+	:  // pattern
+	  CXformExploration(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalInnerJoin(mp),
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp)),  // right child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate
+		  ))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoinSemiJoinReducer::FReducibleOrigin
+//
+//	@doc:
+//		Check if the given join is a join of the query or of an expanded
+//		n-ary join, possibly with its children swapped; the joins that other
+//		xforms produce from a reduced join would be reduced again, each time
+//		sharing their inner child by a new CTE
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformInnerJoinSemiJoinReducer::FReducibleOrigin(CGroupExpression *pgexpr)
+{
+	if (ExfJoinCommutativity == pgexpr->ExfidOrigin())
+	{
+		pgexpr = pgexpr->PgexprOrigin();
+		if (NULL == pgexpr)
+		{
+			return false;
+		}
+	}
+
+	switch (pgexpr->ExfidOrigin())
+	{
+		case ExfInvalid:
+		case ExfExpandNAryJoin:
+		case ExfExpandNAryJoinMinCard:
+		case ExfExpandNAryJoinDP:
+		case ExfExpandNAryJoinGreedy:
+		case ExfExpandNAryJoinDPv2:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoinSemiJoinReducer::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformInnerJoinSemiJoinReducer::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableSemiJoinReduction) ||
+		exprhdl.HasOuterRefs() || exprhdl.DeriveHasSubquery(2))
+	{
+		return CXform::ExfpNone;
+	}
+
+	if (NULL == exprhdl.Pgexpr())
+	{
+		// handle is attached to an expression extracted from the Memo, whose
+		// group expression was already found promising
+		return CXform::ExfpHigh;
+	}
+
+	if (!FReducibleOrigin(exprhdl.Pgexpr()))
+	{
+		return CXform::ExfpNone;
+	}
+
+	// check if stats are derivable on child groups
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+	const ULONG arity = exprhdl.Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CGroup *pgroupChild = (*exprhdl.Pgexpr())[ul];
+		if (!pgroupChild->FScalar() && !pgroupChild->FStatsDerivable(mp))
+		{
+			// stats must be derivable on every child
+			return CXform::ExfpNone;
+		}
+	}
+
+	return CXform::ExfpHigh;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoinSemiJoinReducer::FApplyXformUsingStatsInfo
+//
+//	@doc:
+//		Check the stats ratio to decide whether to apply the xform or not
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformInnerJoinSemiJoinReducer::FApplyXformUsingStatsInfo(
+	const IStatistics *outer_stats, const IStatistics *inner_stats)
+{
+	if (NULL == outer_stats || NULL == inner_stats)
+	{
+		return false;
+	}
+
+	DOUBLE num_rows_outer = outer_stats->Rows().Get();
+	DOUBLE num_rows_inner = inner_stats->Rows().Get();
+	GPOS_ASSERT(0 < num_rows_outer);
+
+	return num_rows_inner / num_rows_outer <= m_dInnerOuterRatioThreshold;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoinSemiJoinReducer::PexprReducerPredicate
+//
+//	@doc:
+//		Construct the predicate of the semi join from the equalities between
+//		outer and inner columns in the join predicate, with inner columns
+//		replaced by their copies in the given mapping; return NULL if the
+//		join predicate has no such equality
+//
+//---------------------------------------------------------------------------
+CExpression *
+CXformInnerJoinSemiJoinReducer::PexprReducerPredicate(
+	CMemoryPool *mp, CExpression *pexprScalar, CColRefSet *pcrsOuter,
+	CColRefSet *pcrsInner, UlongToColRefMap *colref_mapping,
+	CColRefArray **ppdrgpcrKeys)
+{
+	CColRefSet *pcrsKeys = GPOS_NEW(mp) CColRefSet(mp);
+	CExpressionArray *pdrgpexprReducer = GPOS_NEW(mp) CExpressionArray(mp);
+
+	CExpressionArray *pdrgpexprConjuncts =
+		CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+	const ULONG ulConjuncts = pdrgpexprConjuncts->Size();
+	for (ULONG ul = 0; ul < ulConjuncts; ul++)
+	{
+		CExpression *pexprConj = (*pdrgpexprConjuncts)[ul];
+		if (!CPredicateUtils::FPlainEquality(pexprConj))
+		{
+			continue;
+		}
+
+		const CColRef *pcrOuter =
+			CScalarIdent::PopConvert((*pexprConj)[0]->Pop())->Pcr();
+		const CColRef *pcrInner =
+			CScalarIdent::PopConvert((*pexprConj)[1]->Pop())->Pcr();
+		if (pcrsInner->FMember(pcrOuter) && pcrsOuter->FMember(pcrInner))
+		{
+			std::swap(pcrOuter, pcrInner);
+		}
+
+		if (!pcrsOuter->FMember(pcrOuter) || !pcrsInner->FMember(pcrInner))
+		{
+			continue;
+		}
+
+		ULONG colid = pcrInner->Id();
+		CColRef *pcrKey = colref_mapping->Find(&colid);
+		GPOS_ASSERT(NULL != pcrKey);
+
+		pcrsKeys->Include(pcrKey);
+		pdrgpexprReducer->Append(
+			CUtils::PexprScalarEqCmp(mp, pcrOuter, pcrKey));
+	}
+	pdrgpexprConjuncts->Release();
+
+	if (0 == pdrgpexprReducer->Size())
+	{
+		pcrsKeys->Release();
+		pdrgpexprReducer->Release();
+		return NULL;
+	}
+
+	*ppdrgpcrKeys = pcrsKeys->Pdrgpcr(mp);
+	pcrsKeys->Release();
+
+	return CPredicateUtils::PexprConjunction(mp, pdrgpexprReducer);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoinSemiJoinReducer::Transform
+//
+//	@doc:
+//		Actual transformation; the inner child is shared through a CTE
+//		between the semi join and the original join
+//
+//---------------------------------------------------------------------------
+void
+CXformInnerJoinSemiJoinReducer::Transform(CXformContext *pxfctxt,
+										  CXformResult *pxfres,
+										  CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+
+	// extract components
+	CExpression *pexprOuter = (*pexpr)[0];
+	CExpression *pexprInner = (*pexpr)[1];
+	CExpression *pexprScalar = (*pexpr)[2];
+
+	// a shared inner child is not worth sharing again
+	if (COperator::EopLogicalCTEConsumer == pexprInner->Pop()->Eopid() ||
+		!FApplyXformUsingStatsInfo(pexprOuter->Pstats(), pexprInner->Pstats()))
+	{
+		return;
+	}
+
+	// the consumer below the semi join gets a copy of the inner columns
+	CColRefArray *pdrgpcrInner = pexprInner->DeriveOutputColumns()->Pdrgpcr(mp);
+	UlongToColRefMap *colref_mapping = GPOS_NEW(mp) UlongToColRefMap(mp);
+	CColRefArray *pdrgpcrInnerCopy = CUtils::PdrgpcrCopy(
+		mp, pdrgpcrInner, false /*fAllComputed*/, colref_mapping);
+
+	CColRefArray *pdrgpcrKeys = NULL;
+	CExpression *pexprReducerPred = PexprReducerPredicate(
+		mp, pexprScalar, pexprOuter->DeriveOutputColumns(),
+		pexprInner->DeriveOutputColumns(), colref_mapping, &pdrgpcrKeys);
+	colref_mapping->Release();
+
+	if (NULL == pexprReducerPred)
+	{
+		pdrgpcrInner->Release();
+		pdrgpcrInnerCopy->Release();
+		return;
+	}
+
+	const ULONG ulCTEId = COptCtxt::PoctxtFromTLS()->Pcteinfo()->next_id();
+	(void) CXformUtils::PexprAddCTEProducer(mp, ulCTEId, pdrgpcrInner,
+											pexprInner);
+
+	// distinct join keys of the inner child
+	CExpression *pexprKeys = CUtils::PexprLogicalGbAggGlobal(
+		mp, pdrgpcrKeys,
+		CXformUtils::PexprCTEConsumer(mp, ulCTEId, pdrgpcrInnerCopy),
+		GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CScalarProjectList(mp)));
+
+	pexprOuter->AddRef();
+	CExpression *pexprReducer = GPOS_NEW(mp)
+		CExpression(mp, GPOS_NEW(mp) CLogicalLeftSemiJoin(mp), pexprOuter,
+					pexprKeys, pexprReducerPred);
+
+	pexprScalar->AddRef();
+	CExpression *pexprJoin = GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CLogicalInnerJoin(mp), pexprReducer,
+		CXformUtils::PexprCTEConsumer(mp, ulCTEId, pdrgpcrInner), pexprScalar);
+
+	pxfres->Add(GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CLogicalCTEAnchor(mp, ulCTEId), pexprJoin));
+}
+
+// EOF
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformLeftOuterJoin2RightOuterJoin.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformLeftOuterJoin2RightOuterJoin.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftOuterJoin2RightOuterJoin::CXformLeftOuterJoin2RightOuterJoin
+//
+//	@doc:
+//		ctor
+//
+//---------------------------------------------------------------------------
+CXformLeftOuterJoin2RightOuterJoin::CXformLeftOuterJoin2RightOuterJoin(
+	CMemoryPool *mp)
+	: CXformExploration(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalLeftOuterJoin(mp),
+			  GPOS_NEW(mp)
+				  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // right child
+			  GPOS_NEW(mp)
+				  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)))  // predicate
+	  )
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftOuterJoin2RightOuterJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformLeftOuterJoin2RightOuterJoin::Exfp(CExpressionHandle &  // exprhdl
+) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableRightOuterHashJoin))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftOuterJoin2RightOuterJoin::Transform
+//
+//	@doc:
+//		Actual transformation; the preserved left child becomes the right
+//		child of the right outer join
+//
+//---------------------------------------------------------------------------
+void
+CXformLeftOuterJoin2RightOuterJoin::Transform(CXformContext *pxfctxt,
+											  CXformResult *pxfres,
+											  CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+
+	// extract components
+	CExpression *pexprOuter = (*pexpr)[0];
+	CExpression *pexprInner = (*pexpr)[1];
+	CExpression *pexprScalar = (*pexpr)[2];
+
+	// addref children
+	pexprOuter->AddRef();
+	pexprInner->AddRef();
+	pexprScalar->AddRef();
+
+	// assemble transformed expression
+	CExpression *pexprAlt = CUtils::PexprLogicalJoin<CLogicalRightOuterJoin>(
+		mp, pexprInner, pexprOuter, pexprScalar);
+
+	// add alternative to transformation result
+	pxfres->Add(pexprAlt);
+}
+
+
+// EOF
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformPushLimitBelowLeftOuterJoin.cpp
+//
+//	@doc:
+//		Implementation of pushing a limit below the outer child of a left
+//		outer join
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformPushLimitBelowLeftOuterJoin.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformPushLimitBelowLeftOuterJoin::CXformPushLimitBelowLeftOuterJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformPushLimitBelowLeftOuterJoin::CXformPushLimitBelowLeftOuterJoin(
+	CMemoryPool *mp)
+	: CXformExploration(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalLimit(mp),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CLogicalLeftOuterJoin(mp),
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // outer child
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // inner child
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternLeaf(mp))  // predicate
+				  ),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // scalar child for offset
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp)
+						  CPatternLeaf(mp))	 // scalar child for number of rows
+			  ))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformPushLimitBelowLeftOuterJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformPushLimitBelowLeftOuterJoin::Exfp(CExpressionHandle &exprhdl) const
+{
+	CLogicalLimit *popLimit = CLogicalLimit::PopConvert(exprhdl.Pop());
+	if (!GPOS_FTRACE(EopttraceEnableLimitPushDown) || !popLimit->FGlobal() ||
+		!popLimit->FHasCount() ||
+		0 < exprhdl.DeriveOuterReferences()->Size())
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformPushLimitBelowLeftOuterJoin::Transform
+//
+//	@doc:
+//		Actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformPushLimitBelowLeftOuterJoin::Transform(CXformContext *pxfctxt,
+											 CXformResult *pxfres,
+											 CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+
+	// extract components
+	CLogicalLimit *popLimit = CLogicalLimit::PopConvert(pexpr->Pop());
+	CExpression *pexprJoin = (*pexpr)[0];
+	CExpression *pexprScalarStart = (*pexpr)[1];
+	CExpression *pexprScalarRows = (*pexpr)[2];
+	CExpression *pexprOuter = (*pexprJoin)[0];
+	CExpression *pexprInner = (*pexprJoin)[1];
+	CExpression *pexprPred = (*pexprJoin)[2];
+
+	if (COperator::EopLogicalLimit == pexprOuter->Pop()->Eopid())
+	{
+		// outer child is already limited
+		return;
+	}
+
+	// the order must be decided by the outer child alone
+	CColRefSet *pcrsOrder = popLimit->Pos()->PcrsUsed(mp);
+	BOOL fOrderOnOuter =
+		pexprOuter->DeriveOutputColumns()->ContainsAll(pcrsOrder);
+	pcrsOrder->Release();
+	if (!fOrderOnOuter)
+	{
+		return;
+	}
+
+	CExpression *pexprNewOuter = CXformUtils::PexprLimitBelow(
+		mp, pexpr, pexprOuter, NULL /*colref_mapping*/);
+	if (NULL == pexprNewOuter)
+	{
+		// offset or count is not a constant
+		return;
+	}
+
+	pexprJoin->Pop()->AddRef();
+	pexprInner->AddRef();
+	pexprPred->AddRef();
+	CExpression *pexprNewJoin = GPOS_NEW(mp) CExpression(
+		mp, pexprJoin->Pop(), pexprNewOuter, pexprInner, pexprPred);
+
+	popLimit->AddRef();
+	pexprScalarStart->AddRef();
+	pexprScalarRows->AddRef();
+	pxfres->Add(GPOS_NEW(mp) CExpression(mp, popLimit, pexprNewJoin,
+										 pexprScalarStart, pexprScalarRows));
+}
+
+// EOF
@@ -0,0 +1,158 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformPushLimitBelowUnionAll.cpp
+//
+//	@doc:
+//		Implementation of pushing a limit below a UnionAll operation
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/ops.h"
+#include "gpopt/xforms/CXformPushLimitBelowUnionAll.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformPushLimitBelowUnionAll::CXformPushLimitBelowUnionAll
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformPushLimitBelowUnionAll::CXformPushLimitBelowUnionAll(CMemoryPool *mp)
+	: CXformExploration(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalLimit(mp),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CLogicalUnionAll(mp),
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternMultiLeaf(mp))),	 // children
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // scalar child for offset
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp)
+						  CPatternLeaf(mp))	 // scalar child for number of rows
+			  ))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformPushLimitBelowUnionAll::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformPushLimitBelowUnionAll::Exfp(CExpressionHandle &exprhdl) const
+{
+	CLogicalLimit *popLimit = CLogicalLimit::PopConvert(exprhdl.Pop());
+	if (!GPOS_FTRACE(EopttraceEnableLimitPushDown) || !popLimit->FGlobal() ||
+		!popLimit->FHasCount() ||
+		0 < exprhdl.DeriveOuterReferences()->Size())
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformPushLimitBelowUnionAll::Transform
+//
+//	@doc:
+//		Actual transformation; children of the UnionAll that are already
+//		limits are kept as they are
+//
+//---------------------------------------------------------------------------
+void
+CXformPushLimitBelowUnionAll::Transform(CXformContext *pxfctxt,
+										CXformResult *pxfres,
+										CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+
+	// extract components
+	CExpression *pexprUnionAll = (*pexpr)[0];
+	CExpression *pexprScalarStart = (*pexpr)[1];
+	CExpression *pexprScalarRows = (*pexpr)[2];
+	CLogicalUnionAll *popUnionAll =
+		CLogicalUnionAll::PopConvert(pexprUnionAll->Pop());
+	CColRefArray *pdrgpcrOutput = popUnionAll->PdrgpcrOutput();
+	CColRef2dArray *pdrgpdrgpcrInput = popUnionAll->PdrgpdrgpcrInput();
+
+	CExpressionArray *pdrgpexprNewChildren = GPOS_NEW(mp) CExpressionArray(mp);
+	BOOL fNewChild = false;
+	const ULONG arity = pexprUnionAll->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CExpression *pexprChild = (*pexprUnionAll)[ul];
+		if (COperator::EopLogicalLimit == pexprChild->Pop()->Eopid())
+		{
+			pexprChild->AddRef();
+			pdrgpexprNewChildren->Append(pexprChild);
+			continue;
+		}
+
+		// the order of the limit uses the output columns of the UnionAll,
+		// which are also the input columns of its first child
+		CColRefArray *pdrgpcrChild = (*pdrgpdrgpcrInput)[ul];
+		UlongToColRefMap *colref_mapping = NULL;
+		if (!CColRef::Equals(pdrgpcrOutput, pdrgpcrChild))
+		{
+			colref_mapping =
+				CUtils::PhmulcrMapping(mp, pdrgpcrOutput, pdrgpcrChild);
+		}
+		CExpression *pexprChildLimit = CXformUtils::PexprLimitBelow(
+			mp, pexpr, pexprChild, colref_mapping);
+		CRefCount::SafeRelease(colref_mapping);
+
+		if (NULL == pexprChildLimit)
+		{
+			// offset or count is not a constant
+			pdrgpexprNewChildren->Release();
+			return;
+		}
+
+		fNewChild = true;
+		pdrgpexprNewChildren->Append(pexprChildLimit);
+	}
+
+	if (!fNewChild)
+	{
+		// all children of the UnionAll are already limited
+		pdrgpexprNewChildren->Release();
+		return;
+	}
+
+	popUnionAll->AddRef();
+	CExpression *pexprNewUnionAll =
+		GPOS_NEW(mp) CExpression(mp, popUnionAll, pdrgpexprNewChildren);
+
+	pexpr->Pop()->AddRef();
+	pexprScalarStart->AddRef();
+	pexprScalarRows->AddRef();
+	pxfres->Add(GPOS_NEW(mp) CExpression(mp, pexpr->Pop(), pexprNewUnionAll,
+										 pexprScalarStart, pexprScalarRows));
+}
+
+// EOF
@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CXformStats.cpp
+//
+//	@doc:
+//		Process-wide statistics on the yield of xforms
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/memory/CMemoryPoolManager.h"
+
+#include "gpopt/xforms/CXformFactory.h"
+#include "gpopt/xforms/CXformStats.h"
+
+using namespace gpopt;
+
+// global instance of xform statistics
+CXformStats *CXformStats::m_pxfstats = NULL;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::CXformStats
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformStats::CXformStats(CMemoryPool *mp)
+	: m_ulSessionId(gpos::ulong_max), m_mp(mp)
+{
+	GPOS_ASSERT(NULL != mp);
+
+	Reset();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::Reset
+//
+//	@doc:
+//		Forget all statistics
+//
+//---------------------------------------------------------------------------
+void
+CXformStats::Reset()
+{
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		for (ULONG ulBucket = 0; ulBucket < GPOPT_XFORM_STATS_ARITIES;
+			 ulBucket++)
+		{
+			m_rgdCalls[ul][ulBucket] = 0.0;
+			m_rgdResults[ul][ulBucket] = 0.0;
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::Decay
+//
+//	@doc:
+//		Decay all statistics, so that recent queries weigh more than older
+//		ones when the workload changes
+//
+//---------------------------------------------------------------------------
+void
+CXformStats::Decay()
+{
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		for (ULONG ulBucket = 0; ulBucket < GPOPT_XFORM_STATS_ARITIES;
+			 ulBucket++)
+		{
+			m_rgdCalls[ul][ulBucket] *= GPOPT_XFORM_STATS_DECAY;
+			m_rgdResults[ul][ulBucket] *= GPOPT_XFORM_STATS_DECAY;
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::StartQuery
+//
+//	@doc:
+//		Prepare for a new query of the given session; statistics recorded
+//		by other sessions are forgotten rather than decayed, so that the
+//		plans of a session do not depend on what other sessions optimized
+//
+//---------------------------------------------------------------------------
+void
+CXformStats::StartQuery(ULONG ulSessionId)
+{
+	if (ulSessionId != m_ulSessionId)
+	{
+		Reset();
+		m_ulSessionId = ulSessionId;
+		return;
+	}
+
+	Decay();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::DYield
+//
+//	@doc:
+//		Yield of an xform in results per call
+//
+//---------------------------------------------------------------------------
+DOUBLE
+CXformStats::DYield(CXform::EXformId exfid, ULONG arity) const
+{
+	ULONG ulBucket = UlBucket(arity);
+	DOUBLE dCalls = m_rgdCalls[exfid][ulBucket];
+	if (0.0 == dCalls)
+	{
+		return 1.0;
+	}
+
+	return m_rgdResults[exfid][ulBucket] / dCalls;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::FUnproductive
+//
+//	@doc:
+//		Check if an xform was called often enough on expressions of the
+//		given arity to trust its yield, and rarely produced results
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformStats::FUnproductive(CXform::EXformId exfid, ULONG arity) const
+{
+	return GPOPT_XFORM_STATS_MIN_CALLS <= DCalls(exfid, arity) &&
+		   GPOPT_XFORM_STATS_MIN_YIELD > DYield(exfid, arity);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::UlSortByYield
+//
+//	@doc:
+//		Fill the given array with the xforms of the set sorted by ascending
+//		yield; the scheduler runs jobs in reverse order of scheduling, so
+//		scheduling them in this order runs the most productive xforms first.
+//		Only exploration xforms are skipped, so that implementation is never
+//		cut short.
+//
+//---------------------------------------------------------------------------
+ULONG
+CXformStats::UlSortByYield(CXformSet *xform_set, ULONG arity,
+						   BOOL fSkipUnproductive,
+						   CXform::EXformId *rgexfid) const
+{
+	GPOS_ASSERT(NULL != xform_set);
+	GPOS_ASSERT(NULL != rgexfid);
+
+	CXformSet *pxfsExploration = CXformFactory::Pxff()->PxfsExploration();
+
+	ULONG size = 0;
+	CXformSetIter xsi(*xform_set);
+	while (xsi.Advance())
+	{
+		CXform::EXformId exfid = xsi.TBit();
+		if (fSkipUnproductive && pxfsExploration->Get(exfid) &&
+			FUnproductive(exfid, arity))
+		{
+			continue;
+		}
+
+		// insertion sort, sets of applicable xforms are small
+		DOUBLE dYield = DYield(exfid, arity);
+		ULONG ulPos = size;
+		while (0 < ulPos && DYield(rgexfid[ulPos - 1], arity) > dYield)
+		{
+			rgexfid[ulPos] = rgexfid[ulPos - 1];
+			ulPos--;
+		}
+		rgexfid[ulPos] = exfid;
+		size++;
+	}
+
+	return size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::Init
+//
+//	@doc:
+//		Initializes global instance
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CXformStats::Init()
+{
+	GPOS_ASSERT(NULL == Pxfstats() && "Xform stats were already initialized");
+
+	GPOS_RESULT eres = GPOS_OK;
+
+	// create xform stats memory pool
+	CMemoryPool *mp =
+		CMemoryPoolManager::GetMemoryPoolMgr()->CreateMemoryPool();
+	GPOS_TRY
+	{
+		m_pxfstats = GPOS_NEW(mp) CXformStats(mp);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		// destroy memory pool if global instance was not created
+		CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(mp);
+		m_pxfstats = NULL;
+
+		if (GPOS_MATCH_EX(ex, CException::ExmaSystem, CException::ExmiOOM))
+		{
+			eres = GPOS_OOM;
+		}
+		else
+		{
+			eres = GPOS_FAILED;
+		}
+	}
+	GPOS_CATCH_END;
+
+	return eres;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformStats::Shutdown
+//
+//	@doc:
+//		Cleans up allocated memory pool
+//
+//---------------------------------------------------------------------------
+void
+CXformStats::Shutdown()
+{
+	CXformStats *pxfstats = CXformStats::Pxfstats();
+
+	GPOS_ASSERT(NULL != pxfstats && "Xform stats have not been initialized");
+
+	CMemoryPool *mp = pxfstats->m_mp;
+
+	// destroy xform stats
+	CXformStats::m_pxfstats = NULL;
+	GPOS_DELETE(pxfstats);
+
+	// release allocated memory pool
+	CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(mp);
+}
+
+
+// EOF
@@ -1845,7 +1845,23 @@ BOOL
 CXformUtils::FSplitAggXform(CXform::EXformId exfid)
 {
 	return CXform::ExfSplitGbAgg == exfid || CXform::ExfSplitDQA == exfid ||
-		   CXform::ExfSplitGbAggDedup == exfid || CXform::ExfEagerAgg == exfid;
+		   CXform::ExfSplitGbAggDedup == exfid || FEagerAggXform(exfid);
+}
+
+//---------------------------------------------------------------------------
+//   @function:
+//		CXformUtils::FEagerAggXform
+//
+//   @doc:
+//      Check if given xform pushes a local Agg below a join
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformUtils::FEagerAggXform(CXform::EXformId exfid)
+{
+	return CXform::ExfEagerAgg == exfid ||
+		   CXform::ExfEagerAggNAryJoin == exfid ||
+		   CXform::ExfEagerAggLeftOuterJoin == exfid;
 }
 
 BOOL
@@ -1908,8 +1924,9 @@ CXformUtils::FLocalAggCreatedByEagerAggXform(CExpression *pexprAgg)
 	BOOL is_eager_agg = false;
 	while (NULL != pgexprOrigin && !is_eager_agg)
 	{
-		// parse all expressions in group to check if any was created by CXformEagerAgg
-		is_eager_agg = CXform::ExfEagerAgg == pgexprOrigin->ExfidOrigin();
+		// parse all expressions in group to check if any was created by an
+		// eager agg xform
+		is_eager_agg = FEagerAggXform(pgexprOrigin->ExfidOrigin());
 		pgexprOrigin = pgexprOrigin->PgexprOrigin();
 	}
 
@@ -2453,6 +2470,71 @@ CXformUtils::PexprAssertOneRow(CMemoryPool *mp, CExpression *pexprChild)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformUtils::PexprLimitBelow
+//
+//	@doc:
+//		Create a limit on the given child of the relational child of a limit
+//		expression; the new limit keeps the first offset + count rows in the
+//		order of the given limit, with its columns remapped using the given
+//		mapping, if any; return NULL if the offset or the count of the given
+//		limit is not a constant
+//
+//---------------------------------------------------------------------------
+CExpression *
+CXformUtils::PexprLimitBelow(CMemoryPool *mp, CExpression *pexprLimit,
+							 CExpression *pexprChild,
+							 UlongToColRefMap *colref_mapping)
+{
+	GPOS_ASSERT(NULL != pexprLimit);
+	GPOS_ASSERT(COperator::EopLogicalLimit == pexprLimit->Pop()->Eopid());
+	GPOS_ASSERT(NULL != pexprChild);
+
+	CLogicalLimit *popLimit = CLogicalLimit::PopConvert(pexprLimit->Pop());
+	CExpression *pexprOffset = (*pexprLimit)[1];
+	CExpression *pexprCount = (*pexprLimit)[2];
+	if (!popLimit->FHasCount() ||
+		!CUtils::FScalarConstInt<IMDTypeInt8>(pexprOffset) ||
+		!CUtils::FScalarConstInt<IMDTypeInt8>(pexprCount))
+	{
+		return NULL;
+	}
+
+	IDatum *pdatumOffset =
+		CScalarConst::PopConvert(pexprOffset->Pop())->GetDatum();
+	IDatum *pdatumCount =
+		CScalarConst::PopConvert(pexprCount->Pop())->GetDatum();
+	if (pdatumOffset->IsNull() || pdatumCount->IsNull())
+	{
+		return NULL;
+	}
+
+	LINT lRows = dynamic_cast<IDatumInt8 *>(pdatumOffset)->Value() +
+				 dynamic_cast<IDatumInt8 *>(pdatumCount)->Value();
+
+	COrderSpec *pos = popLimit->Pos();
+	if (NULL != colref_mapping)
+	{
+		pos = pos->PosCopyWithRemappedColumns(mp, colref_mapping,
+											  true /*must_exist*/);
+	}
+	else
+	{
+		pos->AddRef();
+	}
+
+	pexprChild->AddRef();
+	return GPOS_NEW(mp) CExpression(
+		mp,
+		GPOS_NEW(mp) CLogicalLimit(mp, pos, true /*fGlobal*/,
+								   true /*fHasCount*/,
+								   false /*fTopLimitUnderDML*/),
+		pexprChild, CUtils::PexprScalarConstInt8(mp, 0 /*val*/),
+		CUtils::PexprScalarConstInt8(mp, lRows));
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CXformUtils::PcrProjectElement
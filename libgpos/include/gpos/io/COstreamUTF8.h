@@ -0,0 +1,66 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		COstreamUTF8.h
+//
+//	@doc:
+//		Output stream class writing UTF-8 into a narrow string
+//---------------------------------------------------------------------------
+#ifndef GPOS_COstreamUTF8_H
+#define GPOS_COstreamUTF8_H
+
+#include "gpos/io/COstream.h"
+#include "gpos/string/CStringDynamic.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		COstreamUTF8
+//
+//	@doc:
+//		Implements an output stream writing to a UTF-8 string; wide
+//		character input is encoded as it is written, so the stream can be
+//		handed to any serializer that writes to an IOstream
+//
+//---------------------------------------------------------------------------
+class COstreamUTF8 : public COstream
+{
+private:
+	// underlying string
+	CStringDynamic *m_string;
+
+	// private copy ctor
+	COstreamUTF8(const COstreamUTF8 &);
+
+public:
+	// please see comments in COstream.h for an explanation
+	using COstream::operator<<;
+
+	// ctor
+	explicit COstreamUTF8(CStringDynamic *str);
+
+	virtual ~COstreamUTF8()
+	{
+	}
+
+	// implement << operator on wide char array
+	virtual IOstream &operator<<(const WCHAR *wc_array);
+
+	// implement << operator on char array
+	virtual IOstream &operator<<(const CHAR *c_array);
+
+	// implement << operator on wide char
+	virtual IOstream &operator<<(const WCHAR wc);
+
+	// implement << operator on char
+	virtual IOstream &operator<<(const CHAR c);
+};
+
+}  // namespace gpos
+
+#endif	// !GPOS_COstreamUTF8_H
+
+// EOF
@@ -87,6 +87,9 @@ private:
 	// link structure to manage pools
 	SLink m_link;
 
+	// number of bytes requested from the pool so far
+	ULLONG m_requested_size;
+
 protected:
 	// invalid memory pool key
 	static const ULONG_PTR m_invalid;
@@ -99,6 +102,11 @@ public:
 		EatArray = 0x7e
 	};
 
+	// ctor
+	CMemoryPool() : m_requested_size(0)
+	{
+	}
+
 	// dtor
 	virtual ~CMemoryPool()
 	{
@@ -118,13 +126,22 @@ public:
 	virtual void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
 						  CMemoryPool::EAllocationType eat) = 0;
 
+	// allocate through the pool implementation, counting the requested bytes
+	void *
+	Allocate(const ULONG bytes, const CHAR *file, const ULONG line,
+			 CMemoryPool::EAllocationType eat)
+	{
+		m_requested_size += bytes;
+		return NewImpl(bytes, file, line, eat);
+	}
+
 	// implementation of array-new with memory pool
 	template <typename T>
 	T *
 	NewArrayImpl(SIZE_T num_elements, const CHAR *filename, ULONG line)
 	{
 		T *array = static_cast<T *>(
-			NewImpl(sizeof(T) * num_elements, filename, line, EatArray));
+			Allocate(sizeof(T) * num_elements, filename, line, EatArray));
 		for (SIZE_T idx = 0; idx < num_elements; ++idx)
 		{
 			try
@@ -155,6 +172,39 @@ public:
 		return 0;
 	}
 
+	// return the number of bytes requested from the pool so far; unlike
+	// TotalAllocatedSize, every pool type keeps it, and it is not reduced
+	// when allocations are freed
+	ULLONG
+	TotalRequestedSize() const
+	{
+		return m_requested_size;
+	}
+
+	// return the largest total allocated size seen so far
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
+	// return the number of allocations made so far
+	virtual ULLONG
+	NumAllocations() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
+	// return the requested size of all allocations made so far
+	virtual ULLONG
+	AllocatedUserSize() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
 	// requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 
@@ -278,7 +328,7 @@ inline void *
 operator new(gpos::SIZE_T size, gpos::CMemoryPool *mp,
 			 const gpos::CHAR *filename, gpos::ULONG line)
 {
-	return mp->NewImpl(size, filename, line, gpos::CMemoryPool::EatSingleton);
+	return mp->Allocate(size, filename, line, gpos::CMemoryPool::EatSingleton);
 }
 
 // Corresponding placement variant of delete operator. Note that, for delete
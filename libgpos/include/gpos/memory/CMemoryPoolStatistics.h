@@ -38,6 +38,10 @@ private:
 
 	ULLONG m_live_obj_total_size;
 
+	ULLONG m_peak_live_obj_total_size;
+
+	ULLONG m_allocated_user_size;
+
 	// private copy ctor
 	CMemoryPoolStatistics(CMemoryPoolStatistics &);
 
@@ -49,7 +53,9 @@ public:
 		  m_num_free(0),
 		  m_num_live_obj(0),
 		  m_live_obj_user_size(0),
-		  m_live_obj_total_size(0)
+		  m_live_obj_total_size(0),
+		  m_peak_live_obj_total_size(0),
+		  m_allocated_user_size(0)
 	{
 	}
 
@@ -101,6 +107,21 @@ public:
 		return m_live_obj_total_size;
 	}
 
+	// get the largest total data size of live objects seen so far
+	ULLONG
+	PeakLiveObjTotalSize() const
+	{
+		return m_peak_live_obj_total_size;
+	}
+
+	// get the user data size of all successful allocations so far, including
+	// those of objects freed since
+	ULLONG
+	AllocatedUserSize() const
+	{
+		return m_allocated_user_size;
+	}
+
 	// record a successful allocation
 	void
 	RecordAllocation(ULONG user_data_size, ULONG total_data_size)
@@ -109,6 +130,11 @@ public:
 		++m_num_live_obj;
 		m_live_obj_user_size += user_data_size;
 		m_live_obj_total_size += total_data_size;
+		m_allocated_user_size += user_data_size;
+		if (m_live_obj_total_size > m_peak_live_obj_total_size)
+		{
+			m_peak_live_obj_total_size = m_live_obj_total_size;
+		}
 	}
 
 	// record a successful free call (of a valid, non-NULL pointer)
@@ -108,6 +108,27 @@ public:
 		return m_memory_pool_statistics.TotalAllocatedSize();
 	}
 
+	// return the largest total allocated size seen so far
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		return m_memory_pool_statistics.PeakLiveObjTotalSize();
+	}
+
+	// return the number of allocations made so far
+	virtual ULLONG
+	NumAllocations() const
+	{
+		return m_memory_pool_statistics.GetNumSuccessfulAllocations();
+	}
+
+	// return the requested size of all allocations made so far
+	virtual ULLONG
+	AllocatedUserSize() const
+	{
+		return m_memory_pool_statistics.AllocatedUserSize();
+	}
+
 #ifdef GPOS_DEBUG
 
 	// check if the memory pool keeps track of live objects
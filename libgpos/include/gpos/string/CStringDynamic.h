@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CStringDynamic.h
+//
+//	@doc:
+//		UTF-8 character string class with dynamic buffer allocation.
+//---------------------------------------------------------------------------
+#ifndef GPOS_CStringDynamic_H
+#define GPOS_CStringDynamic_H
+
+#include "gpos/base.h"
+#include "gpos/string/CStringStatic.h"
+
+#define GPOS_STR_DYNAMIC_CAPACITY_INIT (1 << 7)
+#define GPOS_STR_DYNAMIC_STATIC_BUFFER (1 << 10)
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CStringDynamic
+//
+//	@doc:
+//		Narrow character counterpart of CWStringDynamic. The string is kept
+//		UTF-8 encoded; wide character input is encoded on append, so that
+//		large documents such as serialized DXL take one byte per ASCII
+//		character and can be handed to Xerces or the host without another
+//		conversion pass. Only the UTF-8 overload of CDXLUtils::SerializePlan
+//		writes into it so far; CWString, CMDName and CXMLSerializer remain
+//		wide.
+//
+//---------------------------------------------------------------------------
+class CStringDynamic
+{
+private:
+	// string memory pool used for allocating new memory for the string
+	CMemoryPool *m_mp;
+
+	// null-terminated character buffer
+	CHAR *m_buffer;
+
+	// size of the string in bytes, not counting the terminating '\0'
+	ULONG m_length;
+
+	// buffer capacity
+	ULONG m_capacity;
+
+	// empty string used when no buffer is allocated
+	static const CHAR m_empty_str;
+
+	// increase string capacity
+	void IncreaseCapacity(ULONG requested);
+
+	// find capacity that fits requested string size
+	static ULONG Capacity(ULONG requested);
+
+	// number of bytes in the UTF-8 encoding of a wide character
+	static ULONG UTF8Length(WCHAR wc);
+
+	// write the UTF-8 encoding of a wide character, return number of bytes
+	static ULONG EncodeUTF8(WCHAR wc, CHAR *buffer);
+
+#ifdef GPOS_DEBUG
+	// checks whether a string is properly null-terminated
+	BOOL IsValid() const;
+#endif	// GPOS_DEBUG
+
+	// private copy ctor
+	CStringDynamic(const CStringDynamic &);
+
+public:
+	// ctor
+	explicit CStringDynamic(CMemoryPool *mp);
+
+	// ctor - copies passed string
+	CStringDynamic(CMemoryPool *mp, const CHAR *buffer);
+
+	// dtor
+	~CStringDynamic();
+
+	// returns the character buffer storing the string
+	const CHAR *
+	GetBuffer() const
+	{
+		return m_buffer;
+	}
+
+	// returns the length of the string in bytes
+	ULONG
+	Length() const
+	{
+		return m_length;
+	}
+
+	// checks whether the string is empty
+	BOOL
+	IsEmpty() const
+	{
+		return 0 == m_length;
+	}
+
+	// checks whether the string is byte-wise equal to a character array
+	BOOL Equals(const CHAR *buffer) const;
+
+	// appends a buffer of the given length
+	void AppendBuffer(const CHAR *buffer, ULONG length);
+
+	// appends a null terminated character array
+	void AppendCharArray(const CHAR *buffer);
+
+	// appends a null terminated wide character array, encoding it in UTF-8
+	void AppendWideCharArray(const WCHAR *w_str);
+
+	// appends a formatted string
+	void AppendFormat(const CHAR *format, ...);
+
+	// resets string
+	void Reset();
+};
+}  // namespace gpos
+
+#endif	// !GPOS_CStringDynamic_H
+
+// EOF
@@ -0,0 +1,1048 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		main.cpp
+//
+//	@doc:
+//		Microbenchmarks of gpos containers and memory pools; runs insert,
+//		lookup, iterate and union workloads of growing sizes and writes the
+//		time, allocations and allocated bytes per operation in JSON format
+//
+//		gpos_bench [-w container] [-s max_size] [-n ops] [-r repetitions]
+//				   [-o report.json]
+//
+//		The largest size is rounded down to a power of two. Workloads run
+//		single-threaded, as gpos tasks run on a single worker.
+//---------------------------------------------------------------------------
+
+#include "gpos/_api.h"
+#include "gpos/types.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CHashMapIter.h"
+#include "gpos/common/CMainArgs.h"
+#include "gpos/common/CSyncHashtable.h"
+#include "gpos/common/CSyncHashtableAccessByIter.h"
+#include "gpos/common/CSyncHashtableAccessByKey.h"
+#include "gpos/common/CSyncHashtableIter.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/io/CFileWriter.h"
+#include "gpos/io/ioutils.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/string/CStringDynamic.h"
+
+using namespace gpos;
+
+// smallest and default largest number of elements of a workload; sizes
+// grow by a factor of 8 in between, up to the largest one
+#define GPOS_BENCH_MIN_SIZE 8
+#define GPOS_BENCH_MAX_SIZE (1024 * 1024)
+
+// default number of operations timed in each measurement; small workloads
+// are repeated in rounds until they reach it
+#define GPOS_BENCH_OPS (1024 * 1024)
+
+// default number of measurements of each workload; the fastest is reported
+#define GPOS_BENCH_REPETITIONS 3
+
+// largest bit set; bit sets are lists of fixed-size links, so larger sets
+// take quadratic time to build
+#define GPOS_BENCH_MAX_BITSET_SIZE (32 * 1024)
+
+// command line passed to the benchmark task
+struct SBenchmarkArgs
+{
+	// number of arguments
+	INT m_argc;
+
+	// arguments
+	const CHAR **m_argv;
+};
+
+// timing and allocations of a timed section of a workload
+struct SMeasurement
+{
+	// memory pool of the workload
+	CMemoryPool *m_mp;
+
+	// timer
+	CWallClock m_clock;
+
+	// elapsed time in micro-seconds
+	ULONG m_ulUS;
+
+	// number of allocations
+	ULLONG m_ullAllocations;
+
+	// allocated bytes
+	ULLONG m_ullBytes;
+
+	// start timed section
+	void
+	Start()
+	{
+		m_ullAllocations = m_mp->NumAllocations();
+		m_ullBytes = m_mp->AllocatedUserSize();
+		m_clock.Restart();
+	}
+
+	// stop timed section
+	void
+	Stop()
+	{
+		m_ulUS = m_clock.ElapsedUS();
+		m_ullAllocations = m_mp->NumAllocations() - m_ullAllocations;
+		m_ullBytes = m_mp->AllocatedUserSize() - m_ullBytes;
+	}
+};
+
+// workload function; runs the given number of rounds over the given number
+// of elements, timing them with the given measurement, and returns the
+// number of operations timed
+typedef ULLONG (*PfnWorkload)(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+							  SMeasurement *pmeas);
+
+// hash map of keys to themselves; keys are owned by the workload
+typedef CHashMap<ULONG, ULONG, HashValue<ULONG>, Equals<ULONG>,
+				 CleanupNULL<ULONG>, CleanupNULL<ULONG> >
+	UlongToUlongMap;
+
+typedef CHashMapIter<ULONG, ULONG, HashValue<ULONG>, Equals<ULONG>,
+					 CleanupNULL<ULONG>, CleanupNULL<ULONG> >
+	UlongToUlongMapIter;
+
+// array of keys owned by the workload
+typedef CDynamicPtrArray<ULONG, CleanupNULL> UlongRefArray;
+
+// element of a synchronized hash table
+struct SElem
+{
+	// link
+	SLink m_link;
+
+	// key
+	ULONG m_ulKey;
+
+	// hash function
+	static ULONG
+	HashValue(const ULONG &ulKey)
+	{
+		return gpos::HashValue<ULONG>(&ulKey);
+	}
+
+	// equality function
+	static BOOL
+	FEqualKeys(const ULONG &ulKeyLeft, const ULONG &ulKeyRight)
+	{
+		return ulKeyLeft == ulKeyRight;
+	}
+};
+
+typedef CSyncHashtable<SElem, ULONG> SElemHashtable;
+typedef CSyncHashtableAccessByKey<SElem, ULONG> SElemHashtableAccessor;
+typedef CSyncHashtableIter<SElem, ULONG> SElemHashtableIter;
+typedef CSyncHashtableAccessByIter<SElem, ULONG> SElemHashtableIterAccessor;
+
+// invalid key of a synchronized hash table
+static const ULONG ulInvalidKey = gpos::ulong_max;
+
+// sink for values computed by workloads, so that they are not optimized away
+static volatile ULLONG ullSink = 0;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UlPermute
+//
+//	@doc:
+//		Element of a fixed permutation of [0, size), for a power of two size;
+//		used to insert and look up elements in an order unrelated to their
+//		values
+//
+//---------------------------------------------------------------------------
+static ULONG
+UlPermute(ULONG ul, ULONG size)
+{
+	return (ULONG) (((ULLONG) ul * 40503) % size);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		RgulKeys
+//
+//	@doc:
+//		Allocate the keys of a workload
+//
+//---------------------------------------------------------------------------
+static ULONG *
+RgulKeys(CMemoryPool *mp, ULONG size)
+{
+	ULONG *rgul = GPOS_NEW_ARRAY(mp, ULONG, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		rgul[ul] = UlPermute(ul, size);
+	}
+
+	return rgul;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PhmBuild
+//
+//	@doc:
+//		Build a hash map of the given keys; maps get a chain per element up to
+//		the usual number of chains, and keep that load factor beyond it
+//
+//---------------------------------------------------------------------------
+static UlongToUlongMap *
+PhmBuild(CMemoryPool *mp, ULONG *rgul, ULONG size)
+{
+	UlongToUlongMap *phm =
+		GPOS_NEW(mp) UlongToUlongMap(mp, std::max(size, (ULONG) 127));
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		phm->Insert(&rgul[ul], &rgul[ul]);
+	}
+
+	return phm;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllHashMapInsert
+//
+//	@doc:
+//		Build hash maps
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllHashMapInsert(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				 SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		UlongToUlongMap *phm = PhmBuild(mp, rgul, size);
+		ullSink += phm->Size();
+		phm->Release();
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllHashMapLookup
+//
+//	@doc:
+//		Look up all keys of a hash map
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllHashMapLookup(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				 SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	UlongToUlongMap *phm = PhmBuild(mp, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			ULONG ulKey = ul;
+			ullSink += *phm->Find(&ulKey);
+		}
+	}
+	pmeas->Stop();
+
+	phm->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllHashMapIterate
+//
+//	@doc:
+//		Iterate over all entries of a hash map
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllHashMapIterate(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				  SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	UlongToUlongMap *phm = PhmBuild(mp, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		UlongToUlongMapIter hmi(phm);
+		while (hmi.Advance())
+		{
+			ullSink += *hmi.Value();
+		}
+	}
+	pmeas->Stop();
+
+	phm->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllHashMapMixed
+//
+//	@doc:
+//		Build hash maps, looking up three earlier keys after each insert
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllHashMapMixed(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		UlongToUlongMap *phm =
+			GPOS_NEW(mp) UlongToUlongMap(mp, std::max(size, (ULONG) 127));
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			phm->Insert(&rgul[ul], &rgul[ul]);
+			for (ULONG ulLookup = 1; ulLookup <= 3; ulLookup++)
+			{
+				ullSink += *phm->Find(&rgul[(ul * ulLookup) / 4]);
+			}
+		}
+		phm->Release();
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size * 4;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PbsBuild
+//
+//	@doc:
+//		Build a bit set of the given keys, with the usual link size
+//
+//---------------------------------------------------------------------------
+static CBitSet *
+PbsBuild(CMemoryPool *mp, ULONG *rgul, ULONG size)
+{
+	CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		(void) pbs->ExchangeSet(rgul[ul]);
+	}
+
+	return pbs;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllBitSetInsert
+//
+//	@doc:
+//		Build bit sets
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllBitSetInsert(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		CBitSet *pbs = PbsBuild(mp, rgul, size);
+		ullSink += pbs->Size();
+		pbs->Release();
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllBitSetLookup
+//
+//	@doc:
+//		Look up all bits of a bit set, set or not
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllBitSetLookup(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+
+	// set every other bit
+	CBitSet *pbs = PbsBuild(mp, rgul, size / 2);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			ullSink += pbs->Get(rgul[ul]);
+		}
+	}
+	pmeas->Stop();
+
+	pbs->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllBitSetIterate
+//
+//	@doc:
+//		Iterate over all bits of a bit set
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllBitSetIterate(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				 SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	CBitSet *pbs = PbsBuild(mp, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		CBitSetIter bsi(*pbs);
+		while (bsi.Advance())
+		{
+			ullSink += bsi.Bit();
+		}
+	}
+	pmeas->Stop();
+
+	pbs->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllBitSetUnion
+//
+//	@doc:
+//		Union copies of a bit set with another one overlapping half of it;
+//		each bit of the result is an operation
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllBitSetUnion(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+			   SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	CBitSet *pbsLeft = PbsBuild(mp, rgul, size / 2);
+	CBitSet *pbsRight = PbsBuild(mp, rgul + size / 4, size - size / 4);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, *pbsLeft);
+		pbs->Union(pbsRight);
+		ullSink += pbs->Size();
+		pbs->Release();
+	}
+	pmeas->Stop();
+
+	pbsLeft->Release();
+	pbsRight->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PdrgpulBuild
+//
+//	@doc:
+//		Build an array of the given keys
+//
+//---------------------------------------------------------------------------
+static UlongRefArray *
+PdrgpulBuild(CMemoryPool *mp, ULONG *rgul, ULONG size)
+{
+	UlongRefArray *pdrgpul = GPOS_NEW(mp) UlongRefArray(mp);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		pdrgpul->Append(&rgul[ul]);
+	}
+
+	return pdrgpul;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllArrayInsert
+//
+//	@doc:
+//		Build arrays by appending elements
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllArrayInsert(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+			   SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		UlongRefArray *pdrgpul = PdrgpulBuild(mp, rgul, size);
+		ullSink += pdrgpul->Size();
+		pdrgpul->Release();
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllArrayLookup
+//
+//	@doc:
+//		Access all elements of an array in permuted order
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllArrayLookup(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+			   SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	UlongRefArray *pdrgpul = PdrgpulBuild(mp, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			ullSink += *(*pdrgpul)[rgul[ul]];
+		}
+	}
+	pmeas->Stop();
+
+	pdrgpul->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllArrayIterate
+//
+//	@doc:
+//		Access all elements of an array in order
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllArrayIterate(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+				SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	UlongRefArray *pdrgpul = PdrgpulBuild(mp, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		const ULONG ulSize = pdrgpul->Size();
+		for (ULONG ul = 0; ul < ulSize; ul++)
+		{
+			ullSink += *(*pdrgpul)[ul];
+		}
+	}
+	pmeas->Stop();
+
+	pdrgpul->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllArrayUnion
+//
+//	@doc:
+//		Append two halves of an array to a new array
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllArrayUnion(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+			  SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	UlongRefArray *pdrgpulLeft = PdrgpulBuild(mp, rgul, size / 2);
+	UlongRefArray *pdrgpulRight =
+		PdrgpulBuild(mp, rgul + size / 2, size - size / 2);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		UlongRefArray *pdrgpul = GPOS_NEW(mp) UlongRefArray(mp);
+		pdrgpul->AppendArray(pdrgpulLeft);
+		pdrgpul->AppendArray(pdrgpulRight);
+		ullSink += pdrgpul->Size();
+		pdrgpul->Release();
+	}
+	pmeas->Stop();
+
+	pdrgpulLeft->Release();
+	pdrgpulRight->Release();
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		RgelemBuild
+//
+//	@doc:
+//		Allocate the given number of elements, and insert them into the
+//		given hash table with a bucket per element
+//
+//---------------------------------------------------------------------------
+static SElem *
+RgelemBuild(CMemoryPool *mp, SElemHashtable *psht, ULONG *rgul, ULONG size)
+{
+	SElem *rgelem = GPOS_NEW_ARRAY(mp, SElem, size);
+	psht->Init(mp, size, GPOS_OFFSET(SElem, m_link),
+			   GPOS_OFFSET(SElem, m_ulKey), &ulInvalidKey, SElem::HashValue,
+			   SElem::FEqualKeys);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		rgelem[ul].m_ulKey = rgul[ul];
+		psht->Insert(&rgelem[ul]);
+	}
+
+	return rgelem;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllSyncHashtableInsert
+//
+//	@doc:
+//		Build synchronized hash tables
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllSyncHashtableInsert(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+					   SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		SElemHashtable sht;
+		SElem *rgelem = RgelemBuild(mp, &sht, rgul, size);
+		ullSink += sht.Size();
+		GPOS_DELETE_ARRAY(rgelem);
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllSyncHashtableLookup
+//
+//	@doc:
+//		Look up all keys of a synchronized hash table through accessors
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllSyncHashtableLookup(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+					   SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	SElemHashtable sht;
+	SElem *rgelem = RgelemBuild(mp, &sht, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			SElemHashtableAccessor shtacc(sht, ul);
+			ullSink += shtacc.Find()->m_ulKey;
+		}
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgelem);
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllSyncHashtableIterate
+//
+//	@doc:
+//		Iterate over all elements of a synchronized hash table
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllSyncHashtableIterate(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+						SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	SElemHashtable sht;
+	SElem *rgelem = RgelemBuild(mp, &sht, rgul, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		SElemHashtableIter shtit(sht);
+		while (shtit.Advance())
+		{
+			SElemHashtableIterAccessor shtitacc(shtit);
+			ullSink += shtitacc.Value()->m_ulKey;
+		}
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgelem);
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllMemoryPoolAllocate
+//
+//	@doc:
+//		Allocate objects of 8 to 256 bytes, then free them in the order they
+//		were allocated
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllMemoryPoolAllocate(CMemoryPool *mp, ULONG size, ULONG ulRounds,
+					  SMeasurement *pmeas)
+{
+	ULONG *rgul = RgulKeys(mp, size);
+	BYTE **rgpb = GPOS_NEW_ARRAY(mp, BYTE *, size);
+
+	pmeas->Start();
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			rgpb[ul] = GPOS_NEW_ARRAY(mp, BYTE, 8 + 8 * (rgul[ul] % 32));
+		}
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			GPOS_DELETE_ARRAY(rgpb[ul]);
+		}
+	}
+	pmeas->Stop();
+
+	GPOS_DELETE_ARRAY(rgpb);
+	GPOS_DELETE_ARRAY(rgul);
+
+	return (ULLONG) ulRounds * size;
+}
+
+
+// workloads, in the order they are run
+static const struct SWorkload
+{
+	// benchmarked type
+	const CHAR *m_szType;
+
+	// operation
+	const CHAR *m_szOp;
+
+	// workload function
+	PfnWorkload m_pfn;
+
+	// largest number of elements
+	ULONG m_ulMaxSize;
+} rgworkload[] = {
+	{"CHashMap", "insert", UllHashMapInsert, GPOS_BENCH_MAX_SIZE},
+	{"CHashMap", "lookup", UllHashMapLookup, GPOS_BENCH_MAX_SIZE},
+	{"CHashMap", "iterate", UllHashMapIterate, GPOS_BENCH_MAX_SIZE},
+	{"CHashMap", "mixed", UllHashMapMixed, GPOS_BENCH_MAX_SIZE},
+	{"CBitSet", "insert", UllBitSetInsert, GPOS_BENCH_MAX_BITSET_SIZE},
+	{"CBitSet", "lookup", UllBitSetLookup, GPOS_BENCH_MAX_BITSET_SIZE},
+	{"CBitSet", "iterate", UllBitSetIterate, GPOS_BENCH_MAX_BITSET_SIZE},
+	{"CBitSet", "union", UllBitSetUnion, GPOS_BENCH_MAX_BITSET_SIZE},
+	{"CDynamicPtrArray", "insert", UllArrayInsert, GPOS_BENCH_MAX_SIZE},
+	{"CDynamicPtrArray", "lookup", UllArrayLookup, GPOS_BENCH_MAX_SIZE},
+	{"CDynamicPtrArray", "iterate", UllArrayIterate, GPOS_BENCH_MAX_SIZE},
+	{"CDynamicPtrArray", "union", UllArrayUnion, GPOS_BENCH_MAX_SIZE},
+	{"CSyncHashtable", "insert", UllSyncHashtableInsert, GPOS_BENCH_MAX_SIZE},
+	{"CSyncHashtable", "lookup", UllSyncHashtableLookup, GPOS_BENCH_MAX_SIZE},
+	{"CSyncHashtable", "iterate", UllSyncHashtableIterate,
+	 GPOS_BENCH_MAX_SIZE},
+	{"CMemoryPoolTracker", "allocate", UllMemoryPoolAllocate,
+	 GPOS_BENCH_MAX_SIZE},
+};
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		Measure
+//
+//	@doc:
+//		Measure a workload of the given size the given number of times, and
+//		append the fastest measurement to the report
+//
+//---------------------------------------------------------------------------
+static void
+Measure(const SWorkload &workload, ULONG size, ULLONG ullOps,
+		ULONG ulRepetitions, BOOL fFirst, CStringDynamic *pstrReport)
+{
+	ULONG ulRounds = (ULONG) std::max(ullOps / size, (ULLONG) 1);
+
+	ULLONG ullOpsDone = 0;
+	ULONG ulBestUS = gpos::ulong_max;
+	ULLONG ullAllocations = 0;
+	ULLONG ullBytes = 0;
+	for (ULONG ul = 0; ul < ulRepetitions; ul++)
+	{
+		CAutoMemoryPool amp;
+		SMeasurement meas;
+		meas.m_mp = amp.Pmp();
+
+		ullOpsDone = workload.m_pfn(amp.Pmp(), size, ulRounds, &meas);
+		if (meas.m_ulUS < ulBestUS)
+		{
+			ulBestUS = meas.m_ulUS;
+		}
+		ullAllocations = meas.m_ullAllocations;
+		ullBytes = meas.m_ullBytes;
+	}
+
+	pstrReport->AppendFormat(
+		"%s\n    {\"type\": \"%s\", \"op\": \"%s\", \"size\": %u, "
+		"\"ops\": %llu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.3f, "
+		"\"bytes_per_op\": %.3f}",
+		fFirst ? "" : ",", workload.m_szType, workload.m_szOp, size,
+		ullOpsDone, 1000.0 * ulBestUS / ullOpsDone,
+		(DOUBLE) ullAllocations / ullOpsDone,
+		(DOUBLE) ullBytes / ullOpsDone);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PvExec
+//
+//	@doc:
+//		Function driving execution
+//
+//---------------------------------------------------------------------------
+static void *
+PvExec(void *pv)
+{
+	SBenchmarkArgs *pargs = (SBenchmarkArgs *) pv;
+	CMainArgs ma(pargs->m_argc, pargs->m_argv, "w:s:n:r:o:");
+
+	const CHAR *szType = NULL;
+	ULONG ulMaxSize = GPOS_BENCH_MAX_SIZE;
+	ULLONG ullOps = GPOS_BENCH_OPS;
+	ULONG ulRepetitions = GPOS_BENCH_REPETITIONS;
+	const CHAR *szReportFileName = NULL;
+
+	CHAR ch = '\0';
+	while (ma.Getopt(&ch))
+	{
+		switch (ch)
+		{
+			case 'w':
+				szType = optarg;
+				break;
+
+			case 's':
+				ulMaxSize = (ULONG) clib::Strtol(optarg, NULL, 10 /*base*/);
+				break;
+
+			case 'n':
+				ullOps = (ULLONG) clib::Strtoll(optarg, NULL, 10 /*base*/);
+				break;
+
+			case 'r':
+				ulRepetitions =
+					(ULONG) clib::Strtol(optarg, NULL, 10 /*base*/);
+				break;
+
+			case 'o':
+				szReportFileName = optarg;
+				break;
+
+			default:
+				// ignore other parameters
+				break;
+		}
+	}
+
+	// workloads permute their elements, which needs a power of two size
+	while (0 != (ulMaxSize & (ulMaxSize - 1)))
+	{
+		ulMaxSize &= ulMaxSize - 1;
+	}
+
+	if (GPOS_BENCH_MIN_SIZE > ulMaxSize || 0 == ullOps || 0 == ulRepetitions)
+	{
+		GPOS_TRACE(GPOS_WSZ_LIT(
+			"Usage: gpos_bench [-w container] [-s max_size] [-n ops] "
+			"[-r repetitions] [-o report.json]"));
+		return NULL;
+	}
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CStringDynamic strReport(mp);
+	strReport.AppendFormat("{\n  \"build\": \"%s\",\n  \"results\": [",
+#ifdef GPOS_DEBUG
+						   "debug"
+#else
+						   "release"
+#endif	// GPOS_DEBUG
+	);
+
+	BOOL fFirst = true;
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgworkload); ul++)
+	{
+		const SWorkload &workload = rgworkload[ul];
+		if (NULL != szType && 0 != clib::Strcmp(szType, workload.m_szType))
+		{
+			continue;
+		}
+
+		const ULONG ulLast = std::min(ulMaxSize, workload.m_ulMaxSize);
+		for (ULONG size = GPOS_BENCH_MIN_SIZE; size <= ulLast;
+			 size = (size < ulLast) ? std::min(size * 8, ulLast) : size * 8)
+		{
+			Measure(workload, size, ullOps, ulRepetitions, fFirst,
+					&strReport);
+			fFirst = false;
+		}
+	}
+	strReport.AppendFormat("\n  ]\n}\n");
+
+	if (NULL != szReportFileName)
+	{
+		CFileWriter fw;
+		fw.Open(szReportFileName, S_IRUSR | S_IWUSR);
+		fw.Write((const BYTE *) strReport.GetBuffer(), strReport.Length());
+		fw.Close();
+	}
+	else
+	{
+		CAutoTrace at(mp);
+		at.Os() << std::endl << strReport.GetBuffer();
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		main
+//
+//	@doc:
+//		Entry point for the gpos microbenchmarks
+//
+//---------------------------------------------------------------------------
+INT
+main(INT iArgs, const CHAR **rgszArgs)
+{
+	// Use default allocator
+	struct gpos_init_params gpos_params = {NULL};
+
+	gpos_init(&gpos_params);
+
+	SBenchmarkArgs args = {iArgs, rgszArgs};
+
+	gpos_exec_params params;
+	params.func = PvExec;
+	params.arg = &args;
+	params.stack_start = &params;
+	params.error_buffer = NULL;
+	params.error_buffer_size = -1;
+	params.abort_requested = NULL;
+
+	if (gpos_exec(&params))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+
+// EOF
@@ -46,6 +46,8 @@ public:
 	static GPOS_RESULT EresUnittest_Print();
 #endif	// GPOS_DEBUG
 	static GPOS_RESULT EresUnittest_TestTracker();
+	static GPOS_RESULT EresUnittest_PeakSize();
+	static GPOS_RESULT EresUnittest_Counters();
 	static GPOS_RESULT EresUnittest_TestSlab();
 
 };	// class CMemoryPoolBasicTest
@@ -31,6 +31,7 @@ public:
 	static GPOS_RESULT EresUnittest_Equals();
 	static GPOS_RESULT EresUnittest_Append();
 	static GPOS_RESULT EresUnittest_AppendFormat();
+	static GPOS_RESULT EresUnittest_Dynamic();
 };	// class CStringTest
 }  // namespace gpos
 
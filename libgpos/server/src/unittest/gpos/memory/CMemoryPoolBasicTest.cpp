@@ -45,7 +45,9 @@ CMemoryPoolBasicTest::EresUnittest()
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_Print),
 #endif	// GPOS_DEBUG
-		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker)};
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_PeakSize),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_Counters)};
 
 	CAutoTraceFlag atf(EtraceTestMemoryPools, true /*value*/);
 
@@ -97,6 +99,73 @@ CMemoryPoolBasicTest::EresUnittest_TestTracker()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_PeakSize
+//
+//	@doc:
+//		Check that the peak allocated size survives freeing allocations
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_PeakSize()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULLONG ullInitialSize = mp->TotalAllocatedSize();
+	GPOS_RTL_ASSERT(ullInitialSize <= mp->PeakAllocatedSize());
+
+	BYTE *rgbLarge = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_LARGE);
+	ULLONG ullLargeSize = mp->TotalAllocatedSize();
+	GPOS_RTL_ASSERT(ullLargeSize >=
+					ullInitialSize + GPOS_MEM_TEST_ALLOC_LARGE);
+	GPOS_RTL_ASSERT(ullLargeSize == mp->PeakAllocatedSize());
+
+	GPOS_DELETE_ARRAY(rgbLarge);
+	GPOS_RTL_ASSERT(ullInitialSize == mp->TotalAllocatedSize());
+	GPOS_RTL_ASSERT(ullLargeSize == mp->PeakAllocatedSize());
+
+	// a smaller allocation does not move the peak
+	BYTE *rgbSmall = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_SMALL);
+	GPOS_RTL_ASSERT(ullLargeSize == mp->PeakAllocatedSize());
+	GPOS_DELETE_ARRAY(rgbSmall);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_Counters
+//
+//	@doc:
+//		Check that allocation counters keep counting freed allocations
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_Counters()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULLONG ullAllocations = mp->NumAllocations();
+	ULLONG ullSize = mp->AllocatedUserSize();
+
+	BYTE *rgbLarge = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_LARGE);
+	GPOS_DELETE_ARRAY(rgbLarge);
+	BYTE *rgbSmall = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_SMALL);
+	GPOS_DELETE_ARRAY(rgbSmall);
+
+	GPOS_RTL_ASSERT(ullAllocations + 2 == mp->NumAllocations());
+	GPOS_RTL_ASSERT(ullSize + GPOS_MEM_TEST_ALLOC_LARGE +
+						GPOS_MEM_TEST_ALLOC_SMALL ==
+					mp->AllocatedUserSize());
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresTestType
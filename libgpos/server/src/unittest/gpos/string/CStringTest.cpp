@@ -10,6 +10,8 @@
 //---------------------------------------------------------------------------
 
 #include "gpos/base.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/string/CStringDynamic.h"
 #include "gpos/string/CStringStatic.h"
 #include "gpos/test/CUnittest.h"
 
@@ -33,6 +35,7 @@ CStringTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CStringTest::EresUnittest_Equals),
 		GPOS_UNITTEST_FUNC(CStringTest::EresUnittest_Append),
 		GPOS_UNITTEST_FUNC(CStringTest::EresUnittest_AppendFormat),
+		GPOS_UNITTEST_FUNC(CStringTest::EresUnittest_Dynamic),
 	};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -142,4 +145,45 @@ CStringTest::EresUnittest_Equals()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringTest::EresUnittest_Dynamic
+//
+//	@doc:
+//		Test appending to dynamic UTF-8 strings
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CStringTest::EresUnittest_Dynamic()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CStringDynamic str1(mp, "123");
+	CStringDynamic str2(mp);
+
+	GPOS_ASSERT(str1.Equals("123"));
+	GPOS_ASSERT(str2.IsEmpty());
+
+	// append enough characters to grow the buffer several times
+	for (ULONG ul = 0; ul < 100; ul++)
+	{
+		str2.AppendCharArray("0123456789");
+	}
+	str2.AppendFormat("%d-%s", 42, "x");
+	GPOS_ASSERT(1004 == str2.Length());
+
+	// wide characters are encoded in UTF-8: one, two, three and four bytes,
+	// and the replacement character for a lone surrogate
+	str1.Reset();
+	str1.AppendWideCharArray(GPOS_WSZ_LIT("a\x00e9\x20ac"));
+	str1.AppendWideCharArray(GPOS_WSZ_LIT("\x1f600\xd800"));
+	GPOS_ASSERT(str1.Equals("a\xc3\xa9\xe2\x82\xac"
+							"\xf0\x9f\x98\x80\xef\xbf\xbd"));
+	GPOS_ASSERT(13 == str1.Length());
+
+	return GPOS_OK;
+}
+
 // EOF
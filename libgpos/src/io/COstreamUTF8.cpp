@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		COstreamUTF8.cpp
+//
+//	@doc:
+//		Implementation of UTF-8 string output stream
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/io/COstreamUTF8.h"
+
+using namespace gpos;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COstreamUTF8::COstreamUTF8
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+COstreamUTF8::COstreamUTF8(CStringDynamic *str) : COstream(), m_string(str)
+{
+	GPOS_ASSERT(m_string && "Backing string cannot be NULL");
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COstreamUTF8::operator<<
+//
+//	@doc:
+//		WCHAR array write thru, encoded in UTF-8
+//
+//---------------------------------------------------------------------------
+IOstream &
+COstreamUTF8::operator<<(const WCHAR *wc_array)
+{
+	m_string->AppendWideCharArray(wc_array);
+
+	return *this;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COstreamUTF8::operator<<
+//
+//	@doc:
+//		CHAR array write thru
+//
+//---------------------------------------------------------------------------
+IOstream &
+COstreamUTF8::operator<<(const CHAR *c_array)
+{
+	m_string->AppendCharArray(c_array);
+
+	return *this;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COstreamUTF8::operator<<
+//
+//	@doc:
+//		WCHAR write thru, encoded in UTF-8
+//
+//---------------------------------------------------------------------------
+IOstream &
+COstreamUTF8::operator<<(const WCHAR wc)
+{
+	WCHAR wc_array[2];
+	wc_array[0] = wc;
+	wc_array[1] = L'\0';
+	m_string->AppendWideCharArray(wc_array);
+
+	return *this;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COstreamUTF8::operator<<
+//
+//	@doc:
+//		CHAR write thru
+//
+//---------------------------------------------------------------------------
+IOstream &
+COstreamUTF8::operator<<(const CHAR c)
+{
+	m_string->AppendBuffer(&c, 1);
+
+	return *this;
+}
+
+// EOF
@@ -0,0 +1,419 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CStringDynamic.cpp
+//
+//	@doc:
+//		Implementation of the UTF-8 character string class
+//		with dynamic buffer allocation.
+//---------------------------------------------------------------------------
+
+#include "gpos/common/clibwrapper.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/string/CStringDynamic.h"
+#include "gpos/string/CWString.h"
+
+using namespace gpos;
+
+// encoding of the replacement character U+FFFD, used for wide characters
+// that are not valid code points or are UTF-16 surrogates
+#define GPOS_UTF8_REPLACEMENT_CHAR "\xEF\xBF\xBD"
+
+const CHAR CStringDynamic::m_empty_str = CHAR_EOS;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::CStringDynamic
+//
+//	@doc:
+//		Constructs an empty string
+//
+//---------------------------------------------------------------------------
+CStringDynamic::CStringDynamic(CMemoryPool *mp)
+	: m_mp(mp), m_buffer(NULL), m_length(0), m_capacity(0)
+{
+	Reset();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::CStringDynamic
+//
+//	@doc:
+//		Constructs a new string and initializes it with the given buffer
+//
+//---------------------------------------------------------------------------
+CStringDynamic::CStringDynamic(CMemoryPool *mp, const CHAR *buffer)
+	: m_mp(mp), m_buffer(NULL), m_length(0), m_capacity(0)
+{
+	GPOS_ASSERT(NULL != buffer);
+
+	Reset();
+	AppendCharArray(buffer);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::~CStringDynamic
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CStringDynamic::~CStringDynamic()
+{
+	Reset();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::Reset
+//
+//	@doc:
+//		Resets string
+//
+//---------------------------------------------------------------------------
+void
+CStringDynamic::Reset()
+{
+	if (NULL != m_buffer && &m_empty_str != m_buffer)
+	{
+		GPOS_DELETE_ARRAY(m_buffer);
+	}
+
+	m_buffer = const_cast<CHAR *>(&m_empty_str);
+	m_length = 0;
+	m_capacity = 0;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::Equals
+//
+//	@doc:
+//		Checks whether the string is byte-wise equal to a character array
+//
+//---------------------------------------------------------------------------
+BOOL
+CStringDynamic::Equals(const CHAR *buffer) const
+{
+	GPOS_ASSERT(NULL != buffer);
+
+	ULONG length = GPOS_SZ_LENGTH(buffer);
+
+	return m_length == length &&
+		   0 == clib::Strncmp(m_buffer, buffer, length);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::AppendBuffer
+//
+//	@doc:
+//		Appends a buffer of the given length to the current string
+//
+//---------------------------------------------------------------------------
+void
+CStringDynamic::AppendBuffer(const CHAR *buffer, ULONG length)
+{
+	GPOS_ASSERT(NULL != buffer);
+
+	if (0 == length)
+	{
+		return;
+	}
+
+	// expand buffer if needed
+	ULONG new_length = m_length + length;
+	if (new_length + 1 > m_capacity)
+	{
+		IncreaseCapacity(new_length);
+	}
+
+	(void) clib::Memcpy(m_buffer + m_length, buffer, length);
+	m_buffer[new_length] = CHAR_EOS;
+	m_length = new_length;
+
+	GPOS_ASSERT(IsValid());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::AppendCharArray
+//
+//	@doc:
+//		Appends a null terminated character array; the array is expected
+//		to be UTF-8 encoded already
+//
+//---------------------------------------------------------------------------
+void
+CStringDynamic::AppendCharArray(const CHAR *buffer)
+{
+	GPOS_ASSERT(NULL != buffer);
+
+	AppendBuffer(buffer, GPOS_SZ_LENGTH(buffer));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::AppendWideCharArray
+//
+//	@doc:
+//		Appends a null terminated wide character array, encoding it in UTF-8.
+//		Unlike wcstombs, the result does not depend on the current locale,
+//		which matches the encoding declared in DXL documents.
+//
+//---------------------------------------------------------------------------
+void
+CStringDynamic::AppendWideCharArray(const WCHAR *w_str)
+{
+	GPOS_ASSERT(NULL != w_str);
+
+	// find the length of the encoded string first, so that the buffer
+	// is expanded at most once
+	ULONG length = 0;
+	for (const WCHAR *wc = w_str; WCHAR_EOS != *wc; wc++)
+	{
+		length += UTF8Length(*wc);
+	}
+
+	if (0 == length)
+	{
+		return;
+	}
+
+	ULONG new_length = m_length + length;
+	if (new_length + 1 > m_capacity)
+	{
+		IncreaseCapacity(new_length);
+	}
+
+	CHAR *buffer = m_buffer + m_length;
+	for (const WCHAR *wc = w_str; WCHAR_EOS != *wc; wc++)
+	{
+		buffer += EncodeUTF8(*wc, buffer);
+	}
+	GPOS_ASSERT(buffer == m_buffer + new_length);
+
+	m_buffer[new_length] = CHAR_EOS;
+	m_length = new_length;
+
+	GPOS_ASSERT(IsValid());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::AppendFormat
+//
+//	@doc:
+//		Appends a formatted string
+//
+//---------------------------------------------------------------------------
+void
+CStringDynamic::AppendFormat(const CHAR *format, ...)
+{
+	GPOS_ASSERT(NULL != format);
+	using clib::Vsnprintf;
+
+	VA_LIST va_args;
+
+	// attempt to fit the formatted string in a static array
+	CHAR buffer_static[GPOS_STR_DYNAMIC_STATIC_BUFFER];
+
+	VA_START(va_args, format);
+	INT res = Vsnprintf(buffer_static, GPOS_ARRAY_SIZE(buffer_static), format,
+						va_args);
+	VA_END(va_args);
+	GPOS_ASSERT(0 <= res);
+
+	if (ULONG(res) < GPOS_ARRAY_SIZE(buffer_static))
+	{
+		AppendBuffer(buffer_static, ULONG(res));
+		return;
+	}
+
+	// the static buffer is too small, print directly into the string
+	ULONG new_length = m_length + ULONG(res);
+	if (new_length + 1 > m_capacity)
+	{
+		IncreaseCapacity(new_length);
+	}
+
+	VA_START(va_args, format);
+	Vsnprintf(m_buffer + m_length, res + 1, format, va_args);
+	VA_END(va_args);
+
+	m_length = new_length;
+	GPOS_ASSERT(IsValid());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::UTF8Length
+//
+//	@doc:
+//		Number of bytes in the UTF-8 encoding of a wide character
+//
+//---------------------------------------------------------------------------
+ULONG
+CStringDynamic::UTF8Length(WCHAR wc)
+{
+	ULONG code_point = (ULONG) wc;
+
+	if (0x80 > code_point)
+	{
+		return 1;
+	}
+
+	if (0x800 > code_point)
+	{
+		return 2;
+	}
+
+	if (0x10000 > code_point)
+	{
+		return 3;
+	}
+
+	if (0x110000 > code_point)
+	{
+		return 4;
+	}
+
+	// invalid code point, encoded as the replacement character
+	return 3;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::EncodeUTF8
+//
+//	@doc:
+//		Write the UTF-8 encoding of a wide character into the given buffer,
+//		and return the number of bytes written
+//
+//---------------------------------------------------------------------------
+ULONG
+CStringDynamic::EncodeUTF8(WCHAR wc, CHAR *buffer)
+{
+	ULONG code_point = (ULONG) wc;
+
+	switch (UTF8Length(wc))
+	{
+		case 1:
+			buffer[0] = (CHAR) code_point;
+			return 1;
+
+		case 2:
+			buffer[0] = (CHAR)(0xC0 | (code_point >> 6));
+			buffer[1] = (CHAR)(0x80 | (code_point & 0x3F));
+			return 2;
+
+		case 3:
+			if (0x10000 <= code_point ||
+				(0xD800 <= code_point && 0xE000 > code_point))
+			{
+				// not a valid code point, or a lone UTF-16 surrogate
+				(void) clib::Memcpy(buffer, GPOS_UTF8_REPLACEMENT_CHAR, 3);
+				return 3;
+			}
+			buffer[0] = (CHAR)(0xE0 | (code_point >> 12));
+			buffer[1] = (CHAR)(0x80 | ((code_point >> 6) & 0x3F));
+			buffer[2] = (CHAR)(0x80 | (code_point & 0x3F));
+			return 3;
+
+		default:
+			buffer[0] = (CHAR)(0xF0 | (code_point >> 18));
+			buffer[1] = (CHAR)(0x80 | ((code_point >> 12) & 0x3F));
+			buffer[2] = (CHAR)(0x80 | ((code_point >> 6) & 0x3F));
+			buffer[3] = (CHAR)(0x80 | (code_point & 0x3F));
+			return 4;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::IncreaseCapacity
+//
+//	@doc:
+//		Increase string capacity
+//
+//---------------------------------------------------------------------------
+void
+CStringDynamic::IncreaseCapacity(ULONG requested)
+{
+	GPOS_ASSERT(requested + 1 > m_capacity);
+
+	ULONG capacity = Capacity(requested + 1);
+	GPOS_ASSERT(capacity > requested + 1);
+	GPOS_ASSERT(capacity >= (m_capacity << 1));
+
+	CAutoRg<CHAR> a_new_buffer;
+	a_new_buffer = GPOS_NEW_ARRAY(m_mp, CHAR, capacity);
+
+	// copy the current string including its terminator
+	(void) clib::Memcpy(a_new_buffer.Rgt(), m_buffer, m_length + 1);
+
+	// release old buffer
+	if (m_buffer != &m_empty_str)
+	{
+		GPOS_DELETE_ARRAY(m_buffer);
+	}
+	m_buffer = a_new_buffer.RgtReset();
+	m_capacity = capacity;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::Capacity
+//
+//	@doc:
+//		Find capacity that fits requested string size
+//
+//---------------------------------------------------------------------------
+ULONG
+CStringDynamic::Capacity(ULONG requested)
+{
+	ULONG capacity = GPOS_STR_DYNAMIC_CAPACITY_INIT;
+	while (capacity <= requested + 1)
+	{
+		capacity = capacity << 1;
+	}
+
+	return capacity;
+}
+
+
+#ifdef GPOS_DEBUG
+//---------------------------------------------------------------------------
+//	@function:
+//		CStringDynamic::IsValid
+//
+//	@doc:
+//		Checks whether a string is properly null-terminated
+//
+//---------------------------------------------------------------------------
+BOOL
+CStringDynamic::IsValid() const
+{
+	return (m_length == GPOS_SZ_LENGTH(m_buffer));
+}
+#endif	// GPOS_DEBUG
+
+
+// EOF
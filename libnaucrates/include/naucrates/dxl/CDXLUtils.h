@@ -15,6 +15,7 @@
 #include "gpos/base.h"
 #include "gpos/common/CAutoP.h"
 #include "gpos/io/IOstream.h"
+#include "gpos/string/CStringDynamic.h"
 #include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/dxl/operators/CDXLNode.h"
@@ -170,6 +171,13 @@ public:
 							  BOOL serialize_document_header_footer,
 							  BOOL indentation);
 
+	// serialize a plan into a UTF-8 encoded DXL document; an entry point for
+	// hosts, used in this tree only by the minidump benchmark
+	static CStringDynamic *SerializePlan(CMemoryPool *mp, const CDXLNode *node,
+										 ULLONG plan_id, ULLONG plan_space_size,
+										 BOOL serialize_document_header_footer,
+										 BOOL indentation);
+
 	static CWStringDynamic *SerializeStatistics(
 		CMemoryPool *mp, CMDAccessor *md_accessor,
 		const CStatisticsArray *statistics_array, BOOL serialize_header_footer,
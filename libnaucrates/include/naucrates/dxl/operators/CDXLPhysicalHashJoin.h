@@ -42,6 +42,10 @@ enum Edxlhj
 class CDXLPhysicalHashJoin : public CDXLPhysicalJoin
 {
 private:
+	// id of the runtime filter built from the hash table and applied by
+	// scans on the probe side, gpos::ulong_max if no filter is built
+	ULONG m_runtime_filter_id;
+
 	// private copy ctor
 	CDXLPhysicalHashJoin(const CDXLPhysicalHashJoin &);
 
@@ -53,6 +57,23 @@ public:
 	Edxlopid GetDXLOperator() const;
 	const CWStringConst *GetOpNameStr() const;
 
+	// id of the runtime filter built by the join
+	ULONG
+	RuntimeFilterId() const
+	{
+		return m_runtime_filter_id;
+	}
+
+	// does the join build a runtime filter
+	BOOL
+	HasRuntimeFilter() const
+	{
+		return gpos::ulong_max != m_runtime_filter_id;
+	}
+
+	// set the id of the runtime filter built by the join
+	void SetRuntimeFilterId(ULONG runtime_filter_id);
+
 	// serialize operator in DXL format
 	virtual void SerializeToDXL(CXMLSerializer *xml_serializer,
 								const CDXLNode *dxlnode) const;
@@ -42,6 +42,9 @@ private:
 	// table descriptor for the scanned table
 	CDXLTableDescr *m_dxl_table_descr;
 
+	// ids of the runtime filters applied to the scanned tuples, NULL if none
+	ULongPtrArray *m_runtime_filter_ids;
+
 	// private copy ctor
 	CDXLPhysicalTableScan(CDXLPhysicalTableScan &);
 
@@ -57,6 +60,9 @@ public:
 	// setters
 	void SetTableDescriptor(CDXLTableDescr *);
 
+	// apply the runtime filter built by a hash join to the scanned tuples
+	void AddRuntimeFilterId(ULONG runtime_filter_id);
+
 	// operator type
 	virtual Edxlopid GetDXLOperator() const;
 
@@ -66,6 +72,13 @@ public:
 	// table descriptor
 	const CDXLTableDescr *GetDXLTableDescr();
 
+	// ids of the runtime filters applied to the scanned tuples
+	const ULongPtrArray *
+	GetRuntimeFilterIds() const
+	{
+		return m_runtime_filter_ids;
+	}
+
 	// serialize operator in DXL format
 	virtual void SerializeToDXL(CXMLSerializer *xml_serializer,
 								const CDXLNode *dxlnode) const;
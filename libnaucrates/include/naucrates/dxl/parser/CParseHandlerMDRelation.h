@@ -85,6 +85,9 @@ protected:
 	// is part constraint unbounded
 	BOOL m_part_constraint_unbounded;
 
+	// foreign keys
+	CMDForeignKeyArray *m_foreign_key_array;
+
 	// helper function to parse main relation attributes: name, id,
 	// distribution policy and keys
 	void ParseRelationAttributes(const Attributes &attrs,
@@ -93,6 +96,9 @@ protected:
 	// create and activate the parse handler for the children nodes
 	void ParseChildNodes();
 
+	// helper function to parse a foreign key of the relation
+	void ParseForeignKey(const Attributes &attrs);
+
 private:
 	// private copy ctor
 	CParseHandlerMDRelation(const CParseHandlerMDRelation &);
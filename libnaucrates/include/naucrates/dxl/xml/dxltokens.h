@@ -65,6 +65,8 @@ enum Edxltoken
 	EdxltokenBroadcastThreshold,
 	EdxltokenEnforceConstraintsOnDML,
 	EdxltokenPushGroupByBelowSetopThreshold,
+	EdxltokenMemoryBudget,
+	EdxltokenOptimizationDeadline,
 	EdxltokenWindowOids,
 	EdxltokenOidRowNumber,
 	EdxltokenOidRank,
@@ -289,6 +291,8 @@ enum Edxltoken
 	EdxltokenJoinLeftAntiSemiJoinNotIn,
 
 	EdxltokenMergeJoinUniqueOuter,
+	EdxltokenRuntimeFilterId,
+	EdxltokenRuntimeFilterIds,
 
 	EdxltokenAggStrategy,
 	EdxltokenAggStrategyPlain,
@@ -515,6 +519,8 @@ enum Edxltoken
 
 	EdxltokenCheckConstraints,
 	EdxltokenCheckConstraint,
+	EdxltokenForeignKey,
+	EdxltokenForeignKeyRefCols,
 	EdxltokenPartConstraint,
 	EdxltokenDefaultPartition,
 	EdxltokenPartConstraintUnbounded,
@@ -69,9 +69,6 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
-	// DXL string for object
-	CWStringDynamic *m_dxl_str;
-
 	// private copy ctor
 	CDXLColStats(const CDXLColStats &);
 
@@ -92,9 +89,6 @@ public:
 	// relation name
 	virtual CMDName Mdname() const;
 
-	// DXL string representation of cache object
-	virtual const CWStringDynamic *GetStrRepr() const;
-
 	// number of buckets
 	virtual ULONG Buckets() const;
 
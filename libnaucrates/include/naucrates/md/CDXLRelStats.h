@@ -58,9 +58,6 @@ private:
 	// flag to indicate if input relation is empty
 	BOOL m_empty;
 
-	// DXL string for object
-	CWStringDynamic *m_dxl_str;
-
 	// private copy ctor
 	CDXLRelStats(const CDXLRelStats &);
 
@@ -76,9 +73,6 @@ public:
 	// relation name
 	virtual CMDName Mdname() const;
 
-	// DXL string representation of cache object
-	virtual const CWStringDynamic *GetStrRepr() const;
-
 	// number of rows
 	virtual CDouble Rows() const;
 
@@ -39,9 +39,6 @@ class CMDAggregateGPDB : public IMDAggregate
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// aggregate id
 	IMDId *m_mdid;
 
@@ -76,13 +73,6 @@ public:
 	//dtor
 	~CMDAggregateGPDB();
 
-	// string representation of object
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// aggregate id
 	virtual IMDId *MDId() const;
 
@@ -26,9 +26,6 @@ using namespace gpdxl;
 class CMDArrayCoerceCastGPDB : public CMDCastGPDB
 {
 private:
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// type mod
 	INT m_type_modifier;
 
@@ -56,13 +53,6 @@ public:
 	// dtor
 	virtual ~CMDArrayCoerceCastGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	Pstr() const
-	{
-		return m_dxl_str;
-	}
-
 	// return type modifier
 	virtual INT TypeModifier() const;
 
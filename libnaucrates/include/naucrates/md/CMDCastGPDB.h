@@ -39,9 +39,6 @@ protected:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// func id
 	IMDId *m_mdid;
 
@@ -72,13 +69,6 @@ public:
 	// dtor
 	virtual ~CMDCastGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// cast object id
 	virtual IMDId *MDId() const;
 
@@ -55,9 +55,6 @@ private:
 	// the DXL representation of the check constraint
 	CDXLNode *m_dxl_node;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 public:
 	// ctor
 	CMDCheckConstraintGPDB(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
@@ -87,13 +84,6 @@ public:
 		return m_rel_mdid;
 	}
 
-	// DXL string for check constraint
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// the scalar expression of the check constraint
 	virtual CExpression *GetCheckConstraintExpr(
 		CMemoryPool *mp, CMDAccessor *md_accessor,
@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CMDForeignKey.h
+//
+//	@doc:
+//		Implementation of foreign key constraints in relation metadata
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDForeignKey_H
+#define GPMD_CMDForeignKey_H
+
+#include "gpos/base.h"
+#include "naucrates/md/IMDId.h"
+#include "naucrates/md/IMDInterface.h"
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+// class for a foreign key constraint in relation metadata; the key columns
+// of the relation reference the given columns of the referenced relation,
+// which form a key of that relation
+class CMDForeignKey : public IMDInterface
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// mdid of the referenced relation
+	IMDId *m_mdid_ref_rel;
+
+	// positions of the key columns in the referencing relation
+	ULongPtrArray *m_key_col_array;
+
+	// positions of the referenced columns in the referenced relation
+	ULongPtrArray *m_ref_col_array;
+
+	// private copy ctor
+	CMDForeignKey(const CMDForeignKey &);
+
+public:
+	// ctor
+	CMDForeignKey(CMemoryPool *mp, IMDId *mdid_ref_rel,
+				  ULongPtrArray *key_col_array, ULongPtrArray *ref_col_array);
+
+	// dtor
+	virtual ~CMDForeignKey();
+
+	// mdid of the referenced relation
+	IMDId *ReferencedRelMdid() const;
+
+	// number of key columns
+	ULONG KeyColumnCount() const;
+
+	// position of the i-th key column in the referencing relation
+	ULONG KeyColumnAt(ULONG pos) const;
+
+	// position of the i-th referenced column in the referenced relation
+	ULONG ReferencedColumnAt(ULONG pos) const;
+
+	// serialize foreign key in DXL format given a serializer object
+	virtual void Serialize(CXMLSerializer *) const;
+
+#ifdef GPOS_DEBUG
+	// debug print of the foreign key
+	virtual void DebugPrint(IOstream &os) const;
+#endif
+};
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CMDForeignKey_H
+
+// EOF
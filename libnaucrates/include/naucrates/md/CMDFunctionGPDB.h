@@ -36,9 +36,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// func id
 	IMDId *m_mdid;
 
@@ -98,13 +95,6 @@ public:
 
 	virtual ~CMDFunctionGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// function id
 	virtual IMDId *MDId() const;
 
@@ -66,9 +66,6 @@ private:
 	// partition constraint
 	IMDPartConstraint *m_mdpart_constraint;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// private copy ctor
 	CMDIndexGPDB(const CMDIndexGPDB &);
 
@@ -117,13 +114,6 @@ public:
 	// part constraint
 	virtual IMDPartConstraint *MDPartConstraint() const;
 
-	// DXL string for index
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// serialize MD index in DXL format given a serializer object
 	virtual void Serialize(gpdxl::CXMLSerializer *) const;
 
@@ -47,9 +47,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// relation mdid
 	IMDId *m_mdid;
 
@@ -117,13 +114,6 @@ public:
 	// dtor
 	virtual ~CMDRelationCtasGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// the metadata id
 	virtual IMDId *MDId() const;
 
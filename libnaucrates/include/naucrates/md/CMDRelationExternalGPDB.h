@@ -45,9 +45,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// relation mdid
 	IMDId *m_mdid;
 
@@ -126,13 +123,6 @@ public:
 	// dtor
 	virtual ~CMDRelationExternalGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// the metadata id
 	virtual IMDId *MDId() const;
 
@@ -48,9 +48,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// relation mdid
 	IMDId *m_mdid;
 
@@ -102,6 +99,9 @@ private:
 	// partition constraint
 	IMDPartConstraint *m_mdpart_constraint;
 
+	// array of foreign keys
+	CMDForeignKeyArray *m_mdforeign_key_array;
+
 	// does this table have oids
 	BOOL m_has_oids;
 
@@ -136,18 +136,12 @@ public:
 					CMDIndexInfoArray *md_index_info_array,
 					IMdIdArray *mdid_triggers_array,
 					IMdIdArray *mdid_check_constraint_array,
-					IMDPartConstraint *mdpart_constraint, BOOL has_oids);
+					IMDPartConstraint *mdpart_constraint, BOOL has_oids,
+					CMDForeignKeyArray *mdforeign_key_array = NULL);
 
 	// dtor
 	virtual ~CMDRelationGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// the metadata id
 	virtual IMDId *MDId() const;
 
@@ -253,6 +247,12 @@ public:
 	// part constraint
 	virtual IMDPartConstraint *MDPartConstraint() const;
 
+	// number of foreign keys
+	virtual ULONG ForeignKeyCount() const;
+
+	// retrieve the foreign key at the given position
+	virtual const CMDForeignKey *ForeignKeyAt(ULONG pos) const;
+
 #ifdef GPOS_DEBUG
 	// debug print of the metadata relation
 	virtual void DebugPrint(IOstream &os) const;
@@ -36,9 +36,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// object id
 	IMDId *m_mdid;
 
@@ -69,13 +66,6 @@ public:
 	// dtor
 	virtual ~CMDScCmpGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// copmarison object id
 	virtual IMDId *MDId() const;
 
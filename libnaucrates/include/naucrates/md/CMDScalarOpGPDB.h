@@ -37,9 +37,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// operator id
 	IMDId *m_mdid;
 
@@ -90,13 +87,6 @@ public:
 
 	~CMDScalarOpGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// operator id
 	virtual IMDId *MDId() const;
 
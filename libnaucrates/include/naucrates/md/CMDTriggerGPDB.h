@@ -39,9 +39,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// trigger id
 	IMDId *m_mdid;
 
@@ -72,13 +69,6 @@ public:
 	// dtor
 	~CMDTriggerGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// trigger id
 	virtual IMDId *
 	MDId() const
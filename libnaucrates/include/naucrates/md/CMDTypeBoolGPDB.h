@@ -89,9 +89,6 @@ private:
 	// count aggregate
 	IMDId *m_mdid_count;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// type name and id
 	static CWStringConst m_str;
 	static CMDName m_mdname;
@@ -109,13 +106,6 @@ public:
 	// dtor
 	virtual ~CMDTypeBoolGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// type id
 	virtual IMDId *MDId() const;
 
@@ -53,9 +53,6 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// metadata id
 	IMDId *m_mdid;
 
@@ -154,13 +151,6 @@ public:
 	// dtor
 	virtual ~CMDTypeGenericGPDB();
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	virtual IMDId *MDId() const;
 
 	virtual CMDName Mdname() const;
@@ -94,9 +94,6 @@ private:
 	// count aggregate
 	IMDId *m_mdid_count;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// type name and type
 	static CWStringConst m_str;
 	static CMDName m_mdname;
@@ -118,13 +115,6 @@ public:
 	virtual IDatumInt2 *CreateInt2Datum(CMemoryPool *mp, SINT value,
 										BOOL is_null) const;
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// accessor of metadata id
 	virtual IMDId *MDId() const;
 
@@ -94,9 +94,6 @@ private:
 	// count aggregate
 	IMDId *m_mdid_count;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// type name and type
 	static CWStringConst m_str;
 	static CMDName m_mdname;
@@ -118,13 +115,6 @@ public:
 	virtual IDatumInt4 *CreateInt4Datum(CMemoryPool *mp, INT iValue,
 										BOOL is_null) const;
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	virtual IMDId *MDId() const;
 
 	virtual CMDName Mdname() const;
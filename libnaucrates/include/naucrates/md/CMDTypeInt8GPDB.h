@@ -95,9 +95,6 @@ private:
 	// count aggregate
 	IMDId *m_mdid_count;
 
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// type name
 	static CWStringConst m_str;
 	static CMDName m_mdname;
@@ -118,13 +115,6 @@ public:
 	virtual IDatumInt8 *CreateInt8Datum(CMemoryPool *mp, LINT value,
 										BOOL is_null) const;
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	// type id
 	virtual IMDId *MDId() const;
 
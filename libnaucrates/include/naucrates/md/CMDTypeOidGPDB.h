@@ -92,9 +92,6 @@ private:
 
 	// count aggregate
 	IMDId *m_mdid_count;
-	// DXL for object
-	const CWStringDynamic *m_dxl_str;
-
 	// type name and type
 	static CWStringConst m_str;
 	static CMDName m_mdname;
@@ -115,13 +112,6 @@ public:
 	virtual IDatumOid *CreateOidDatum(CMemoryPool *mp, OID oValue,
 									  BOOL is_null) const;
 
-	// accessors
-	virtual const CWStringDynamic *
-	GetStrRepr() const
-	{
-		return m_dxl_str;
-	}
-
 	virtual IMDId *MDId() const;
 
 	virtual CMDName Mdname() const;
@@ -89,9 +89,6 @@ public:
 	// serialize object in DXL format
 	virtual void Serialize(gpdxl::CXMLSerializer *) const = 0;
 
-	// DXL string representation of cache object
-	virtual const CWStringDynamic *GetStrRepr() const = 0;
-
 
 	// serialize the metadata id information as the attributes of an
 	// element with the given name
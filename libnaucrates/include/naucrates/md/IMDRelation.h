@@ -19,6 +19,7 @@
 #include "naucrates/md/IMDPartConstraint.h"
 #include "naucrates/statistics/IStatistics.h"
 #include "naucrates/md/CMDIndexInfo.h"
+#include "naucrates/md/CMDForeignKey.h"
 
 namespace gpdxl
 {
@@ -185,6 +186,12 @@ public:
 	// part constraint
 	virtual IMDPartConstraint *MDPartConstraint() const = 0;
 
+	// number of foreign keys
+	virtual ULONG ForeignKeyCount() const;
+
+	// retrieve the foreign key at the given position
+	virtual const CMDForeignKey *ForeignKeyAt(ULONG pos) const;
+
 	// relation distribution policy as a string value
 	static const CWStringConst *GetDistrPolicyStr(
 		Ereldistrpolicy rel_distr_policy);
@@ -205,6 +212,9 @@ public:
 // common structure over relation and external relation metadata for index info
 typedef CDynamicPtrArray<CMDIndexInfo, CleanupRelease> CMDIndexInfoArray;
 
+// array of foreign keys of a relation
+typedef CDynamicPtrArray<CMDForeignKey, CleanupRelease> CMDForeignKeyArray;
+
 }  // namespace gpmd
 
 
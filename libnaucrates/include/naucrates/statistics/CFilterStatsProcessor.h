@@ -62,6 +62,20 @@ private:
 												 CDouble *last_scale_factor,
 												 ULONG *target_last_colid);
 
+	// set the frequencies of the given buckets based on the distinct points
+	// of an array comparison mapping to them
+	static void ComputeArrayCmpBuckets(CMemoryPool *mp, CPointArray *points,
+									   CBucketArray *buckets,
+									   ULONG *num_distinct, ULONG *ndv_remain);
+
+	// same as above, using binary search over the native keys of the
+	// points (see CRange::LNativeKey); returns false if they cannot be used
+	static BOOL ComputeArrayCmpBucketsNative(CMemoryPool *mp,
+											 CPointArray *points,
+											 CBucketArray *buckets,
+											 ULONG *num_distinct,
+											 ULONG *ndv_remain);
+
 	// create a new hash map of histograms after applying a conjunctive or disjunctive filter
 	static UlongToHistogramMap *MakeHistHashMapConjOrDisjFilter(
 		CMemoryPool *mp, const CStatisticsConfig *stats_config,
@@ -207,6 +207,51 @@ enum EOptTraceFlag
 	// Consider non-equality predicates in Dynamic partition selection
 	EopttraceAllowGeneralPredicatesforDPE = 103037,
 
+	// keep all cost contexts of completed search stages in the memo
+	EopttraceDisableMemoCompaction = 103038,
+
+	// record the yield of xforms across the queries of a session
+	EopttraceRecordXformStats = 103039,
+
+	// order transformation jobs by recorded xform yield, and skip
+	// unproductive exploration xforms in large queries; a skipped xform
+	// may have produced the only alternative satisfying a requirement
+	EopttraceXformStatsGuidedSearch = 103040,
+
+	// generate index only scans for btree indexes covering the query
+	EopttraceEnableIndexOnlyScan = 103041,
+
+	// implement full outer joins with hash joins
+	EopttraceEnableFullOuterHashJoin = 103042,
+
+	// build the hash table of left outer hash joins on the preserved side
+	EopttraceEnableRightOuterHashJoin = 103043,
+
+	// annotate selective hash joins with runtime filters applied by the
+	// table scans on their probe side
+	EopttraceEnableRuntimeJoinFilters = 103044,
+
+	// push partial aggregates below n-ary joins and the outer child of left
+	// outer joins, for any aggregate with a combine function
+	EopttraceEnableGeneralizedEagerAgg = 103045,
+
+	// remove left outer joins to a unique key and inner joins on a declared
+	// foreign key when the joined relation contributes no output columns
+	EopttraceEnableJoinElimination = 103046,
+
+	// reduce large join children by semi joins on the distinct join keys of
+	// small join children
+	EopttraceEnableSemiJoinReduction = 103047,
+
+	// implement inner and left outer joins with merge joins
+	EopttraceEnableMergeJoin = 103048,
+
+	// limit the input of windows filtered on their row numbers
+	EopttraceEnableWindowTopK = 103049,
+
+	// push limits below union all and the outer child of left outer joins
+	EopttraceEnableLimitPushDown = 103050,
+
 	///////////////////////////////////////////////////////
 	///////////////////// statistics flags ////////////////
 	//////////////////////////////////////////////////////
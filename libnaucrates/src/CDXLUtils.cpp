@@ -17,6 +17,7 @@
 #include "gpos/io/ioutils.h"
 #include "gpos/io/CFileReader.h"
 #include "gpos/io/COstreamString.h"
+#include "gpos/io/COstreamUTF8.h"
 #include "gpos/task/CAutoTraceFlag.h"
 #include "gpos/task/CWorker.h"
 #include "gpos/task/CTraceFlagIter.h"
@@ -261,11 +262,11 @@ CDXLUtils::GetParseHandlerForDXLString(CMemoryPool *mp,
 									   const CWStringBase *dxl_string,
 									   const CHAR *xsd_file_path)
 {
-	CAutoRg<CHAR> multi_byte_char_string;
-	multi_byte_char_string =
-		CreateMultiByteCharStringFromWCString(mp, dxl_string->GetBuffer());
-	CParseHandlerDXL *parse_handler_dxl = GetParseHandlerForDXLString(
-		mp, multi_byte_char_string.Rgt(), xsd_file_path);
+	// documents are declared as UTF-8, encode them accordingly
+	CStringDynamic utf8_string(mp);
+	utf8_string.AppendWideCharArray(dxl_string->GetBuffer());
+	CParseHandlerDXL *parse_handler_dxl =
+		GetParseHandlerForDXLString(mp, utf8_string.GetBuffer(), xsd_file_path);
 	return parse_handler_dxl;
 }
 
@@ -494,12 +495,12 @@ CDXLUtils::ParseDXLToMDRequest(CMemoryPool *mp, const WCHAR *dxl_string,
 {
 	GPOS_ASSERT(NULL != mp);
 
-	CAutoRg<CHAR> multi_byte_char_string_wrapper(
-		CDXLUtils::CreateMultiByteCharStringFromWCString(mp, dxl_string));
+	CStringDynamic utf8_string(mp);
+	utf8_string.AppendWideCharArray(dxl_string);
 
 	// create and install a parse handler for the DXL document
-	CMDRequest *md_request = ParseDXLToMDRequest(
-		mp, multi_byte_char_string_wrapper.Rgt(), xsd_file_path);
+	CMDRequest *md_request =
+		ParseDXLToMDRequest(mp, utf8_string.GetBuffer(), xsd_file_path);
 
 	return md_request;
 }
@@ -935,6 +936,36 @@ CDXLUtils::SerializePlan(CMemoryPool *mp, IOstream &os, const CDXLNode *node,
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializePlan
+//
+//	@doc:
+//		Serialize a DXL tree into a UTF-8 encoded DXL document. The document
+//		is encoded as it is written, without building a wide character
+//		document first. This is an entry point for hosts, used in this tree
+//		only by the minidump benchmark; the optimizer's own serialization
+//		(minidumps, traces, metadata and statistics) still writes wide
+//		character streams.
+//
+//---------------------------------------------------------------------------
+CStringDynamic *
+CDXLUtils::SerializePlan(CMemoryPool *mp, const CDXLNode *node, ULLONG plan_id,
+						 ULLONG plan_space_size, BOOL serialize_header_footer,
+						 BOOL indentation)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != node);
+
+	CAutoP<CStringDynamic> string_var(GPOS_NEW(mp) CStringDynamic(mp));
+	COstreamUTF8 os(string_var.Value());
+
+	SerializePlan(mp, os, node, plan_id, plan_space_size,
+				  serialize_header_footer, indentation);
+
+	return string_var.Reset();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::SerializeMetadata
@@ -15,7 +15,6 @@
 #include "naucrates/md/CDXLColStats.h"
 
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 #include "gpos/common/CAutoRef.h"
 
@@ -49,8 +48,6 @@ CDXLColStats::CDXLColStats(CMemoryPool *mp, CMDIdColStats *mdid_col_stats,
 {
 	GPOS_ASSERT(mdid_col_stats->IsValid());
 	GPOS_ASSERT(NULL != dxl_stats_bucket_array);
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -64,7 +61,6 @@ CDXLColStats::CDXLColStats(CMemoryPool *mp, CMDIdColStats *mdid_col_stats,
 CDXLColStats::~CDXLColStats()
 {
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 	m_mdid_col_stats->Release();
 	m_dxl_stats_bucket_array->Release();
 }
@@ -97,20 +93,6 @@ CDXLColStats::Mdname() const
 	return *m_mdname;
 }
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CDXLColStats::GetMDName
-//
-//	@doc:
-//		Returns the DXL string for this object
-//
-//---------------------------------------------------------------------------
-const CWStringDynamic *
-CDXLColStats::GetStrRepr() const
-{
-	return m_dxl_str;
-}
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLColStats::Buckets
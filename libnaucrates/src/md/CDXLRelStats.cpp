@@ -38,8 +38,6 @@ CDXLRelStats::CDXLRelStats(CMemoryPool *mp, CMDIdRelStats *rel_stats_mdid,
 	  m_empty(is_empty)
 {
 	GPOS_ASSERT(rel_stats_mdid->IsValid());
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -53,7 +51,6 @@ CDXLRelStats::CDXLRelStats(CMemoryPool *mp, CMDIdRelStats *rel_stats_mdid,
 CDXLRelStats::~CDXLRelStats()
 {
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 	m_rel_stats_mdid->Release();
 }
 
@@ -85,20 +82,6 @@ CDXLRelStats::Mdname() const
 	return *m_mdname;
 }
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CDXLRelStats::GetMDName
-//
-//	@doc:
-//		Returns the DXL string for this object
-//
-//---------------------------------------------------------------------------
-const CWStringDynamic *
-CDXLRelStats::GetStrRepr() const
-{
-	return m_dxl_str;
-}
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLRelStats::Rows
@@ -15,7 +15,6 @@
 
 #include "naucrates/md/CMDAggregateGPDB.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpmd;
 using namespace gpdxl;
@@ -43,9 +42,6 @@ CMDAggregateGPDB::CMDAggregateGPDB(CMemoryPool *mp, IMDId *mdid,
 	  m_hash_agg_capable(is_hash_agg_capable)
 {
 	GPOS_ASSERT(mdid->IsValid());
-
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -62,7 +58,6 @@ CMDAggregateGPDB::~CMDAggregateGPDB()
 	m_mdid_type_intermediate->Release();
 	m_mdid_type_result->Release();
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 }
 
 //---------------------------------------------------------------------------
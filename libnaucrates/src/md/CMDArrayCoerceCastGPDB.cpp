@@ -15,7 +15,6 @@
 
 #include "naucrates/md/CMDArrayCoerceCastGPDB.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpmd;
 using namespace gpdxl;
@@ -33,14 +32,11 @@ CMDArrayCoerceCastGPDB::CMDArrayCoerceCastGPDB(
 	  m_dxl_coerce_format(dxl_coerce_format),
 	  m_location(location)
 {
-	m_dxl_str = CDXLUtils::SerializeMDObj(mp, this, false /*fSerializeHeader*/,
-										  false /*indentation*/);
 }
 
 // dtor
 CMDArrayCoerceCastGPDB::~CMDArrayCoerceCastGPDB()
 {
-	GPOS_DELETE(m_dxl_str);
 }
 
 // return type modifier
@@ -15,7 +15,6 @@
 
 #include "naucrates/md/CMDCastGPDB.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpmd;
 using namespace gpdxl;
@@ -45,9 +44,6 @@ CMDCastGPDB::CMDCastGPDB(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
 	GPOS_ASSERT(m_mdid_src->IsValid());
 	GPOS_ASSERT(m_mdid_dest->IsValid());
 	GPOS_ASSERT_IMP(!is_binary_coercible, m_mdid_cast_func->IsValid());
-
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -65,7 +61,6 @@ CMDCastGPDB::~CMDCastGPDB()
 	m_mdid_dest->Release();
 	CRefCount::SafeRelease(m_mdid_cast_func);
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 }
 
 
@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		CMDForeignKey.cpp
+//
+//	@doc:
+//		Implementation of the class for representing foreign keys
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CMDForeignKey.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+// ctor
+CMDForeignKey::CMDForeignKey(CMemoryPool *mp, IMDId *mdid_ref_rel,
+							 ULongPtrArray *key_col_array,
+							 ULongPtrArray *ref_col_array)
+	: m_mp(mp),
+	  m_mdid_ref_rel(mdid_ref_rel),
+	  m_key_col_array(key_col_array),
+	  m_ref_col_array(ref_col_array)
+{
+	GPOS_ASSERT(mdid_ref_rel->IsValid());
+	GPOS_ASSERT(NULL != key_col_array);
+	GPOS_ASSERT(NULL != ref_col_array);
+	GPOS_ASSERT(0 < key_col_array->Size());
+	GPOS_ASSERT(key_col_array->Size() == ref_col_array->Size());
+}
+
+// dtor
+CMDForeignKey::~CMDForeignKey()
+{
+	m_mdid_ref_rel->Release();
+	m_key_col_array->Release();
+	m_ref_col_array->Release();
+}
+
+// returns the metadata id of the referenced relation
+IMDId *
+CMDForeignKey::ReferencedRelMdid() const
+{
+	return m_mdid_ref_rel;
+}
+
+// number of key columns
+ULONG
+CMDForeignKey::KeyColumnCount() const
+{
+	return m_key_col_array->Size();
+}
+
+// position of the i-th key column in the referencing relation
+ULONG
+CMDForeignKey::KeyColumnAt(ULONG pos) const
+{
+	return *((*m_key_col_array)[pos]);
+}
+
+// position of the i-th referenced column in the referenced relation
+ULONG
+CMDForeignKey::ReferencedColumnAt(ULONG pos) const
+{
+	return *((*m_ref_col_array)[pos]);
+}
+
+// serialize foreign key in DXL format
+void
+CMDForeignKey::Serialize(gpdxl::CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenForeignKey));
+
+	m_mdid_ref_rel->Serialize(xml_serializer,
+							  CDXLTokens::GetDXLTokenStr(EdxltokenMdid));
+
+	CWStringDynamic *key_cols_str = CDXLUtils::Serialize(m_mp, m_key_col_array);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenIndexKeyCols), key_cols_str);
+	GPOS_DELETE(key_cols_str);
+
+	CWStringDynamic *ref_cols_str = CDXLUtils::Serialize(m_mp, m_ref_col_array);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenForeignKeyRefCols), ref_cols_str);
+	GPOS_DELETE(ref_cols_str);
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenForeignKey));
+}
+
+#ifdef GPOS_DEBUG
+// prints a foreign key to the provided output
+void
+CMDForeignKey::DebugPrint(IOstream &os) const
+{
+	os << "Referenced relation id: ";
+	ReferencedRelMdid()->OsPrint(os);
+	os << std::endl;
+
+	os << "Key columns: ";
+	const ULONG size = KeyColumnCount();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (0 < ul)
+		{
+			os << ", ";
+		}
+		os << KeyColumnAt(ul) << " -> " << ReferencedColumnAt(ul);
+	}
+	os << std::endl;
+}
+
+#endif	// GPOS_DEBUG
+
+// EOF
@@ -15,7 +15,6 @@
 
 #include "naucrates/md/CMDFunctionGPDB.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpmd;
 using namespace gpdxl;
@@ -50,8 +49,6 @@ CMDFunctionGPDB::CMDFunctionGPDB(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
 	GPOS_ASSERT(EfdaSentinel > func_data_access);
 
 	InitDXLTokenArrays();
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -68,7 +65,6 @@ CMDFunctionGPDB::~CMDFunctionGPDB()
 	m_mdid_type_result->Release();
 	CRefCount::SafeRelease(m_mdid_types_array);
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 }
 
 //---------------------------------------------------------------------------
@@ -99,8 +99,6 @@ CMDRelationExternalGPDB::CMDRelationExternalGPDB(
 			GPOS_NEW(m_mp) INT(pmdcol->AttrNum()), GPOS_NEW(m_mp) ULONG(ul));
 		m_col_width_array->Append(GPOS_NEW(mp) CDouble(pmdcol->Length()));
 	}
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -114,7 +112,6 @@ CMDRelationExternalGPDB::CMDRelationExternalGPDB(
 CMDRelationExternalGPDB::~CMDRelationExternalGPDB()
 {
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 	m_mdid->Release();
 	m_md_col_array->Release();
 	CRefCount::SafeRelease(m_distr_col_array);
@@ -36,7 +36,8 @@ CMDRelationGPDB::CMDRelationGPDB(
 	ULONG num_of_partitions, BOOL convert_hash_to_random,
 	ULongPtr2dArray *keyset_array, CMDIndexInfoArray *md_index_info_array,
 	IMdIdArray *mdid_triggers_array, IMdIdArray *mdid_check_constraint_array,
-	IMDPartConstraint *mdpart_constraint, BOOL has_oids)
+	IMDPartConstraint *mdpart_constraint, BOOL has_oids,
+	CMDForeignKeyArray *mdforeign_key_array)
 	: m_mp(mp),
 	  m_mdid(mdid),
 	  m_mdname(mdname),
@@ -55,6 +56,7 @@ CMDRelationGPDB::CMDRelationGPDB(
 	  m_mdid_trigger_array(mdid_triggers_array),
 	  m_mdid_check_constraint_array(mdid_check_constraint_array),
 	  m_mdpart_constraint(mdpart_constraint),
+	  m_mdforeign_key_array(mdforeign_key_array),
 	  m_has_oids(has_oids),
 	  m_system_columns(0),
 	  m_colpos_nondrop_colpos_map(NULL),
@@ -108,8 +110,6 @@ CMDRelationGPDB::CMDRelationGPDB(
 
 		m_col_width_array->Append(GPOS_NEW(mp) CDouble(mdcol->Length()));
 	}
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -123,7 +123,6 @@ CMDRelationGPDB::CMDRelationGPDB(
 CMDRelationGPDB::~CMDRelationGPDB()
 {
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 	m_mdid->Release();
 	m_md_col_array->Release();
 	CRefCount::SafeRelease(m_distr_col_array);
@@ -135,6 +134,7 @@ CMDRelationGPDB::~CMDRelationGPDB()
 	m_mdid_check_constraint_array->Release();
 	m_col_width_array->Release();
 	CRefCount::SafeRelease(m_mdpart_constraint);
+	CRefCount::SafeRelease(m_mdforeign_key_array);
 	CRefCount::SafeRelease(m_colpos_nondrop_colpos_map);
 	CRefCount::SafeRelease(m_attrno_nondrop_col_pos_map);
 	CRefCount::SafeRelease(m_nondrop_col_pos_array);
@@ -629,6 +629,38 @@ CMDRelationGPDB::MDPartConstraint() const
 	return m_mdpart_constraint;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDRelationGPDB::ForeignKeyCount
+//
+//	@doc:
+//		Returns the number of foreign keys of this relation
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDRelationGPDB::ForeignKeyCount() const
+{
+	return (m_mdforeign_key_array == NULL) ? 0
+										   : m_mdforeign_key_array->Size();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDRelationGPDB::ForeignKeyAt
+//
+//	@doc:
+//		Returns the foreign key at the specified position of the foreign
+//		key array
+//
+//---------------------------------------------------------------------------
+const CMDForeignKey *
+CMDRelationGPDB::ForeignKeyAt(ULONG pos) const
+{
+	GPOS_ASSERT(NULL != m_mdforeign_key_array);
+
+	return (*m_mdforeign_key_array)[pos];
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -762,6 +794,15 @@ CMDRelationGPDB::Serialize(CXMLSerializer *xml_serializer) const
 					  CDXLTokens::GetDXLTokenStr(EdxltokenCheckConstraints),
 					  CDXLTokens::GetDXLTokenStr(EdxltokenCheckConstraint));
 
+	// serialize foreign keys
+	const ULONG foreign_keys = ForeignKeyCount();
+	for (ULONG ul = 0; ul < foreign_keys; ul++)
+	{
+		ForeignKeyAt(ul)->Serialize(xml_serializer);
+
+		GPOS_CHECK_ABORT;
+	}
+
 	// serialize part constraint
 	if (NULL != m_mdpart_constraint)
 	{
@@ -852,6 +893,13 @@ CMDRelationGPDB::DebugPrint(IOstream &os) const
 
 	os << "Check Constraint: ";
 	CDXLUtils::DebugPrintMDIdArray(os, m_mdid_check_constraint_array);
+
+	os << "Foreign Keys: ";
+	const ULONG foreign_keys = ForeignKeyCount();
+	for (ULONG ul = 0; ul < foreign_keys; ul++)
+	{
+		ForeignKeyAt(ul)->DebugPrint(os);
+	}
 }
 
 #endif	// GPOS_DEBUG
@@ -15,7 +15,6 @@
 
 #include "naucrates/md/CMDScalarOpGPDB.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpdxl;
 using namespace gpmd;
@@ -49,8 +48,6 @@ CMDScalarOpGPDB::CMDScalarOpGPDB(
 	  m_mdid_opfamilies_array(mdid_opfamilies_array)
 {
 	GPOS_ASSERT(NULL != mdid_opfamilies_array);
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 
@@ -74,7 +71,6 @@ CMDScalarOpGPDB::~CMDScalarOpGPDB()
 	CRefCount::SafeRelease(m_mdid_inverse_opr);
 
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 	m_mdid_opfamilies_array->Release();
 }
 
@@ -15,7 +15,6 @@
 
 #include "naucrates/md/CMDTriggerGPDB.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpmd;
 using namespace gpdxl;
@@ -43,9 +42,6 @@ CMDTriggerGPDB::CMDTriggerGPDB(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
 	GPOS_ASSERT(m_rel_mdid->IsValid());
 	GPOS_ASSERT(m_func_mdid->IsValid());
 	GPOS_ASSERT(0 <= type);
-
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
 //---------------------------------------------------------------------------
@@ -62,7 +58,6 @@ CMDTriggerGPDB::~CMDTriggerGPDB()
 	m_rel_mdid->Release();
 	m_func_mdid->Release();
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 }
 
 //---------------------------------------------------------------------------
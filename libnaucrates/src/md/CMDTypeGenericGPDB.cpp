@@ -25,7 +25,6 @@
 #include "naucrates/dxl/operators/CDXLDatumGeneric.h"
 
 #include "naucrates/dxl/xml/CXMLSerializer.h"
-#include "naucrates/dxl/CDXLUtils.h"
 
 using namespace gpnaucrates;
 using namespace gpdxl;
@@ -87,8 +86,6 @@ CMDTypeGenericGPDB::CMDTypeGenericGPDB(
 {
 	GPOS_ASSERT_IMP(m_is_fixed_length, 0 < m_length);
 	GPOS_ASSERT_IMP(!m_is_fixed_length, 0 > m_gpdb_length);
-	m_dxl_str = CDXLUtils::SerializeMDObj(
-		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 
 	m_mdid->AddRef();
 	m_datum_null = GPOS_NEW(m_mp) CDatumGenericGPDB(
@@ -122,7 +119,6 @@ CMDTypeGenericGPDB::~CMDTypeGenericGPDB()
 	m_mdid_count->Release();
 	CRefCount::SafeRelease(m_mdid_base_relation);
 	GPOS_DELETE(m_mdname);
-	GPOS_DELETE(m_dxl_str);
 	m_datum_null->Release();
 }
 
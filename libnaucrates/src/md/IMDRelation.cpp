@@ -117,4 +117,20 @@ IMDRelation::IsPartialIndex(IMDId *	 // mdid
 	return false;
 }
 
+// number of foreign keys
+ULONG
+IMDRelation::ForeignKeyCount() const
+{
+	return 0;
+}
+
+// retrieve the foreign key at the given position
+const CMDForeignKey *
+IMDRelation::ForeignKeyAt(ULONG	 // pos
+) const
+{
+	GPOS_ASSERT(!"Relation has no foreign keys");
+	return NULL;
+}
+
 // EOF
@@ -124,7 +124,20 @@ CDXLOperatorFactory::MakeDXLHashJoin(CDXLMemoryManager *dxl_memory_manager,
 	EdxlJoinType join_type = ParseJoinType(
 		join_type_xml, CDXLTokens::GetDXLTokenStr(EdxltokenPhysicalHashJoin));
 
-	return GPOS_NEW(mp) CDXLPhysicalHashJoin(mp, join_type);
+	CDXLPhysicalHashJoin *dxl_op =
+		GPOS_NEW(mp) CDXLPhysicalHashJoin(mp, join_type);
+
+	// the join builds a runtime filter for its probe side only if annotated
+	const XMLCh *runtime_filter_id_xml =
+		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenRuntimeFilterId));
+	if (NULL != runtime_filter_id_xml)
+	{
+		dxl_op->SetRuntimeFilterId(ConvertAttrValueToUlong(
+			dxl_memory_manager, runtime_filter_id_xml,
+			EdxltokenRuntimeFilterId, EdxltokenPhysicalHashJoin));
+	}
+
+	return dxl_op;
 }
 
 //---------------------------------------------------------------------------
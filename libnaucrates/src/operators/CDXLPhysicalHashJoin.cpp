@@ -27,7 +27,7 @@ using namespace gpdxl;
 //---------------------------------------------------------------------------
 CDXLPhysicalHashJoin::CDXLPhysicalHashJoin(CMemoryPool *mp,
 										   EdxlJoinType join_type)
-	: CDXLPhysicalJoin(mp, join_type)
+	: CDXLPhysicalJoin(mp, join_type), m_runtime_filter_id(gpos::ulong_max)
 {
 }
 
@@ -60,6 +60,22 @@ CDXLPhysicalHashJoin::GetOpNameStr() const
 	return CDXLTokens::GetDXLTokenStr(EdxltokenPhysicalHashJoin);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalHashJoin::SetRuntimeFilterId
+//
+//	@doc:
+//		Set the id of the runtime filter built from the hash table
+//
+//---------------------------------------------------------------------------
+void
+CDXLPhysicalHashJoin::SetRuntimeFilterId(ULONG runtime_filter_id)
+{
+	GPOS_ASSERT(gpos::ulong_max != runtime_filter_id);
+
+	m_runtime_filter_id = runtime_filter_id;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLPhysicalHashJoin::SerializeToDXL
@@ -80,6 +96,13 @@ CDXLPhysicalHashJoin::SerializeToDXL(CXMLSerializer *xml_serializer,
 	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenJoinType),
 								 GetJoinTypeNameStr());
 
+	if (HasRuntimeFilter())
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenRuntimeFilterId),
+			m_runtime_filter_id);
+	}
+
 	// serialize properties
 	node->SerializePropertiesToDXL(xml_serializer);
 
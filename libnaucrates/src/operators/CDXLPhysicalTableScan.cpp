@@ -12,6 +12,7 @@
 
 #include "naucrates/dxl/operators/CDXLPhysicalTableScan.h"
 
+#include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 
@@ -27,7 +28,7 @@ using namespace gpdxl;
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp)
-	: CDXLPhysical(mp), m_dxl_table_descr(NULL)
+	: CDXLPhysical(mp), m_dxl_table_descr(NULL), m_runtime_filter_ids(NULL)
 {
 }
 
@@ -42,7 +43,9 @@ CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp)
 //---------------------------------------------------------------------------
 CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp,
 											 CDXLTableDescr *table_descr)
-	: CDXLPhysical(mp), m_dxl_table_descr(table_descr)
+	: CDXLPhysical(mp),
+	  m_dxl_table_descr(table_descr),
+	  m_runtime_filter_ids(NULL)
 {
 }
 
@@ -58,6 +61,7 @@ CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp,
 CDXLPhysicalTableScan::~CDXLPhysicalTableScan()
 {
 	CRefCount::SafeRelease(m_dxl_table_descr);
+	CRefCount::SafeRelease(m_runtime_filter_ids);
 }
 
 
@@ -78,6 +82,25 @@ CDXLPhysicalTableScan::SetTableDescriptor(CDXLTableDescr *table_descr)
 	m_dxl_table_descr = table_descr;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalTableScan::AddRuntimeFilterId
+//
+//	@doc:
+//		Apply the runtime filter with the given id to the scanned tuples
+//
+//---------------------------------------------------------------------------
+void
+CDXLPhysicalTableScan::AddRuntimeFilterId(ULONG runtime_filter_id)
+{
+	if (NULL == m_runtime_filter_ids)
+	{
+		m_runtime_filter_ids = GPOS_NEW(m_mp) ULongPtrArray(m_mp);
+	}
+
+	m_runtime_filter_ids->Append(GPOS_NEW(m_mp) ULONG(runtime_filter_id));
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLPhysicalTableScan::GetDXLOperator
@@ -139,6 +162,16 @@ CDXLPhysicalTableScan::SerializeToDXL(CXMLSerializer *xml_serializer,
 	xml_serializer->OpenElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), element_name);
 
+	if (NULL != m_runtime_filter_ids)
+	{
+		CWStringDynamic *str_filter_ids =
+			CDXLUtils::Serialize(m_mp, m_runtime_filter_ids);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenRuntimeFilterIds),
+			str_filter_ids);
+		GPOS_DELETE(str_filter_ids);
+	}
+
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
 
@@ -110,12 +110,21 @@ CParseHandlerHint::StartElement(const XMLCh *const,	 //element_uri,
 			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
 			EdxltokenPushGroupByBelowSetopThreshold, EdxltokenHint, true,
 			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD);
+	ULONG memory_budget = CDXLOperatorFactory::ExtractConvertAttrValueToUlong(
+		m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+		EdxltokenMemoryBudget, EdxltokenHint, true, 0 /*default_value*/);
+	ULONG optimization_deadline =
+		CDXLOperatorFactory::ExtractConvertAttrValueToUlong(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenOptimizationDeadline, EdxltokenHint, true,
+			0 /*default_value*/);
 
 	m_hint = GPOS_NEW(m_mp) CHint(
 		min_num_of_parts_to_require_sort_on_insert,
 		join_arity_for_associativity_commutativity, array_expansion_threshold,
 		join_order_dp_threshold, broadcast_threshold, enforce_constraint_on_dml,
-		push_group_by_below_setop_threshold);
+		push_group_by_below_setop_threshold, memory_budget,
+		optimization_deadline);
 }
 
 //---------------------------------------------------------------------------
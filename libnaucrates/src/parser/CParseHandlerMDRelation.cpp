@@ -51,7 +51,8 @@ CParseHandlerMDRelation::CParseHandlerMDRelation(
 	  m_num_of_partitions(0),
 	  m_key_sets_arrays(NULL),
 	  m_part_constraint(NULL),
-	  m_level_with_default_part_array(NULL)
+	  m_level_with_default_part_array(NULL),
+	  m_foreign_key_array(NULL)
 {
 }
 
@@ -112,6 +113,14 @@ CParseHandlerMDRelation::StartElement(const XMLCh *const,  // element_uri,
 		return;
 	}
 
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenForeignKey),
+				 element_local_name))
+	{
+		ParseForeignKey(attrs);
+		return;
+	}
+
 	if (0 !=
 		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenRelation),
 								 element_local_name))
@@ -234,6 +243,14 @@ CParseHandlerMDRelation::EndElement(const XMLCh *const,	 // element_uri,
 		return;
 	}
 
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenForeignKey),
+				 element_local_name))
+	{
+		// foreign keys were constructed when the element was opened
+		return;
+	}
+
 	if (0 !=
 		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenRelation),
 								 element_local_name))
@@ -275,7 +292,7 @@ CParseHandlerMDRelation::EndElement(const XMLCh *const,	 // element_uri,
 		m_partition_cols_array, m_str_part_types_array, m_num_of_partitions,
 		m_convert_hash_to_random, m_key_sets_arrays, md_index_info_array,
 		mdid_triggers_array, mdid_check_constraint_array, m_part_constraint,
-		m_has_oids);
+		m_has_oids, m_foreign_key_array);
 
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
@@ -345,6 +362,54 @@ CParseHandlerMDRelation::ParseRelationAttributes(const Attributes &attrs,
 		0 /* default value */);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerMDRelation::ParseForeignKey
+//
+//	@doc:
+//		Helper function to parse a foreign key: the referenced relation,
+//		the key columns and the referenced columns
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerMDRelation::ParseForeignKey(const Attributes &attrs)
+{
+	CDXLMemoryManager *dxl_memory_manager =
+		m_parse_handler_mgr->GetDXLMemoryManager();
+
+	IMDId *mdid_ref_rel = CDXLOperatorFactory::ExtractConvertAttrValueToMdId(
+		dxl_memory_manager, attrs, EdxltokenMdid, EdxltokenForeignKey);
+
+	const XMLCh *xml_str_key_cols = CDXLOperatorFactory::ExtractAttrValue(
+		attrs, EdxltokenIndexKeyCols, EdxltokenForeignKey);
+	ULongPtrArray *key_col_array = CDXLOperatorFactory::ExtractIntsToUlongArray(
+		dxl_memory_manager, xml_str_key_cols, EdxltokenIndexKeyCols,
+		EdxltokenForeignKey);
+
+	const XMLCh *xml_str_ref_cols = CDXLOperatorFactory::ExtractAttrValue(
+		attrs, EdxltokenForeignKeyRefCols, EdxltokenForeignKey);
+	ULongPtrArray *ref_col_array = CDXLOperatorFactory::ExtractIntsToUlongArray(
+		dxl_memory_manager, xml_str_ref_cols, EdxltokenForeignKeyRefCols,
+		EdxltokenForeignKey);
+
+	if (key_col_array->Size() != ref_col_array->Size())
+	{
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+				   CDXLTokens::GetDXLTokenStr(EdxltokenForeignKeyRefCols)
+					   ->GetBuffer(),
+				   CDXLTokens::GetDXLTokenStr(EdxltokenForeignKey)
+					   ->GetBuffer());
+	}
+
+	if (NULL == m_foreign_key_array)
+	{
+		m_foreign_key_array = GPOS_NEW(m_mp) CMDForeignKeyArray(m_mp);
+	}
+
+	m_foreign_key_array->Append(GPOS_NEW(m_mp) CMDForeignKey(
+		m_mp, mdid_ref_rel, key_col_array, ref_col_array));
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CParseHandlerMDRelation::ParseChildNodes
@@ -53,10 +53,27 @@ void
 CParseHandlerTableScan::StartElement(const XMLCh *const,  // element_uri,
 									 const XMLCh *const element_local_name,
 									 const XMLCh *const,  // element_qname
-									 const Attributes &	  // attrs
-)
+									 const Attributes &attrs)
 {
 	StartElement(element_local_name, EdxltokenPhysicalTableScan);
+
+	// parse the ids of the runtime filters applied by the scan, if any
+	const XMLCh *runtime_filter_ids_xml =
+		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenRuntimeFilterIds));
+	if (NULL != runtime_filter_ids_xml)
+	{
+		ULongPtrArray *runtime_filter_ids =
+			CDXLOperatorFactory::ExtractIntsToUlongArray(
+				m_parse_handler_mgr->GetDXLMemoryManager(),
+				runtime_filter_ids_xml, EdxltokenRuntimeFilterIds,
+				EdxltokenPhysicalTableScan);
+		const ULONG size = runtime_filter_ids->Size();
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			m_dxl_op->AddRuntimeFilterId(*(*runtime_filter_ids)[ul]);
+		}
+		runtime_filter_ids->Release();
+	}
 }
 
 //---------------------------------------------------------------------------
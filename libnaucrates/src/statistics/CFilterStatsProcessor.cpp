@@ -9,6 +9,10 @@
 //		Statistics helper routines for processing limit operations
 //---------------------------------------------------------------------------
 
+#include "gpos/common/clibwrapper.h"
+
+#include "gpopt/base/CRange.h"
+#include "gpopt/base/CUtils.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 
@@ -824,8 +828,86 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 	//    from base_histogram that should be selected.
 	// 4. Compute and adjust the resultant scale factor for the filter.
 
+	// Create buckets for the result histogram using the same bucket boundaries
+	// as in the base histogram, and set their frequencies based on the
+	// de-duplicated points mapping to each of them.
+	CBucketArray *dummy_histogram_buckets =
+		CHistogram::DeepCopyHistogramBuckets(mp, base_histogram->GetBuckets());
+	ULONG num_distinct = 0;
+	ULONG ndv_remain = 0;
+	if (!ComputeArrayCmpBucketsNative(mp, pred_stats->GetPoints(),
+									  dummy_histogram_buckets, &num_distinct,
+									  &ndv_remain))
+	{
+		ComputeArrayCmpBuckets(mp, pred_stats->GetPoints(),
+							   dummy_histogram_buckets, &num_distinct,
+							   &ndv_remain);
+	}
+	const ULONG colid = pred_stats->GetColId();
+	if (0 == num_distinct)
+	{
+		// the array consists of nulls only, which no value is equal to; like
+		// an empty join histogram, this filters out all rows
+		dummy_histogram_buckets->Release();
+		*last_scale_factor = *last_scale_factor * CDouble(GPOS_FP_ABS_MAX);
+		(void) filter_colids->ExchangeSet(colid);
+		*target_last_colid = colid;
+
+		return GPOS_NEW(mp) CHistogram(mp);
+	}
+	CDouble dummy_rows(num_distinct);
+
+	CDouble freq_remain(0.0);
+	if (ndv_remain != 0)
+	{
+		freq_remain = CDouble(ndv_remain) / dummy_rows;
+	}
+	CHistogram *dummy_histogram = GPOS_NEW(mp)
+		CHistogram(mp, dummy_histogram_buckets, true /* is_well_defined */,
+				   CDouble(0.0) /* null_freq */,
+				   CDouble(ndv_remain) /* distinct_remain */, freq_remain);
+	// dummy histogram should already be normalized since each bucket's frequency
+	// is already adjusted by a scale factor of 1/dummy_rows to avoid unnecessarily
+	// deep-copying the histogram buckets
+	GPOS_ASSERT(dummy_histogram->IsValid() &&
+				dummy_histogram->GetNumDistinct() - dummy_rows <
+					CStatistics::Epsilon);
+
+	// Compute the join'ed histogram
+	CHistogram *result_histogram = base_histogram->MakeJoinHistogram(
+		pred_stats->GetCmpType(), dummy_histogram);
+
+	CDouble local_scale_factor = result_histogram->NormalizeHistogram();
+	// Adjust the local scale factor by the scale factor of dummy histogram
+	local_scale_factor = local_scale_factor / dummy_rows;
+	local_scale_factor = CDouble(std::max(local_scale_factor.Get(), 1.0));
+
+	GPOS_ASSERT(DOUBLE(1.0) <= local_scale_factor.Get());
+
+	// update scale factor
+	*last_scale_factor = *last_scale_factor * local_scale_factor;
+
+	// note column id
+	(void) filter_colids->ExchangeSet(colid);
+	*target_last_colid = colid;
+
+	// clean up
+	GPOS_DELETE(dummy_histogram);
+
+	return result_histogram;
+}
+
+// set the frequency and NDV of the given buckets based on the number of
+// de-duplicated points in the array list that map to each bucket, comparing
+// points and bucket boundaries through their datums
+void
+CFilterStatsProcessor::ComputeArrayCmpBuckets(CMemoryPool *mp,
+											  CPointArray *points,
+											  CBucketArray *buckets,
+											  ULONG *num_distinct,
+											  ULONG *ndv_remain)
+{
 	// First, de-duplicate the constants in the array list
-	CPointArray *points = pred_stats->GetPoints();
 	if (points->Size() > 1)
 	{
 		points->Sort(&CUtils::CPointCmp);
@@ -851,18 +933,13 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 		deduped_points->Append(point);
 		prev_datum = datum;
 	}
-	CDouble dummy_rows(deduped_points->Size());
+	*num_distinct = deduped_points->Size();
+	CDouble dummy_rows(*num_distinct);
 
-	// Create buckets for the result histogram using the same bucket boundaries
-	// as in the base histogram.
-	CBucketArray *dummy_histogram_buckets =
-		CHistogram::DeepCopyHistogramBuckets(mp, base_histogram->GetBuckets());
 	ULONG point_iter = 0;
-	ULONG ndv_remain = 0;
-	for (ULONG bucket_iter = 0; bucket_iter < dummy_histogram_buckets->Size();
-		 ++bucket_iter)
+	for (ULONG bucket_iter = 0; bucket_iter < buckets->Size(); ++bucket_iter)
 	{
-		CBucket *bucket = (*dummy_histogram_buckets)[bucket_iter];
+		CBucket *bucket = (*buckets)[bucket_iter];
 		bucket->SetFrequency(CDouble(0.0));
 		bucket->SetDistinct(CDouble(0.0));
 		ULONG ndv = 0;
@@ -871,7 +948,7 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 		while (point_iter < deduped_points->Size() &&
 			   bucket->IsBefore((*deduped_points)[point_iter]))
 		{
-			ndv_remain++;
+			(*ndv_remain)++;
 			point_iter++;
 		}
 		// if the point is after the bucket, move to the next bucket
@@ -897,49 +974,143 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 	// if we have gone through all the buckets, and there are still points, add them to ndv_remain
 	if (point_iter < deduped_points->Size())
 	{
-		ndv_remain += deduped_points->Size() - point_iter;
+		*ndv_remain += deduped_points->Size() - point_iter;
 	}
 
-	CDouble freq_remain(0.0);
-	if (ndv_remain != 0)
+	deduped_points->Release();
+}
+
+// does the datum have a native key of the given domain; the domain is taken
+// from the datum if it is not set yet
+static BOOL
+FSameNativeKey(IDatum *datum, CRange::ENativeKey *penk)
+{
+	CRange::ENativeKey enk = CRange::EnkDatum(datum);
+	if (CRange::EnkNone == enk ||
+		(CRange::EnkNone != *penk && enk != *penk))
 	{
-		freq_remain = CDouble(ndv_remain) / dummy_rows;
+		return false;
 	}
-	CHistogram *dummy_histogram = GPOS_NEW(mp)
-		CHistogram(mp, dummy_histogram_buckets, true /* is_well_defined */,
-				   CDouble(0.0) /* null_freq */,
-				   CDouble(ndv_remain) /* distinct_remain */, freq_remain);
-	// dummy histogram should already be normalized since each bucket's frequency
-	// is already adjusted by a scale factor of 1/dummy_rows to avoid unnecessarily
-	// deep-copying the histogram buckets
-	GPOS_ASSERT(dummy_histogram->IsValid() &&
-				dummy_histogram->GetNumDistinct() - dummy_rows <
-					CStatistics::Epsilon);
 
-	// Compute the join'ed histogram
-	CHistogram *result_histogram = base_histogram->MakeJoinHistogram(
-		pred_stats->GetCmpType(), dummy_histogram);
+	*penk = enk;
+	return true;
+}
 
-	CDouble local_scale_factor = result_histogram->NormalizeHistogram();
-	// Adjust the local scale factor by the scale factor of dummy histogram
-	local_scale_factor = local_scale_factor / dummy_rows;
-	local_scale_factor = CDouble(std::max(local_scale_factor.Get(), 1.0));
+// index of the first key in the sorted range [begin, end) that is greater
+// than the bound, or greater than or equal to it if the bound is inclusive
+static ULONG
+FirstKeyAfterBound(const LINT *keys, ULONG begin, ULONG end, LINT bound,
+				   BOOL is_inclusive)
+{
+	while (begin < end)
+	{
+		ULONG mid = begin + (end - begin) / 2;
+		BOOL is_after =
+			is_inclusive ? (keys[mid] >= bound) : (keys[mid] > bound);
+		if (is_after)
+		{
+			end = mid;
+		}
+		else
+		{
+			begin = mid + 1;
+		}
+	}
 
-	GPOS_ASSERT(DOUBLE(1.0) <= local_scale_factor.Get());
+	return begin;
+}
 
-	// update scale factor
-	*last_scale_factor = *last_scale_factor * local_scale_factor;
+// same as ComputeArrayCmpBuckets, for the case where the points and the
+// bucket boundaries all have native keys of the same domain (see
+// CRange::EnkDatum), which order them the same way as their stats
+// comparisons. The points are sorted and de-duplicated as an array of keys,
+// and each bucket is probed with a binary search rather than comparing the
+// points one by one. Returns false without touching the buckets otherwise.
+BOOL
+CFilterStatsProcessor::ComputeArrayCmpBucketsNative(CMemoryPool *mp,
+													CPointArray *points,
+													CBucketArray *buckets,
+													ULONG *num_distinct,
+													ULONG *ndv_remain)
+{
+	CRange::ENativeKey enk = CRange::EnkNone;
+	const ULONG num_buckets = buckets->Size();
+	for (ULONG ul = 0; ul < num_buckets; ++ul)
+	{
+		CBucket *bucket = (*buckets)[ul];
+		if (!FSameNativeKey(bucket->GetLowerBound()->GetDatum(), &enk) ||
+			!FSameNativeKey(bucket->GetUpperBound()->GetDatum(), &enk))
+		{
+			return false;
+		}
+	}
 
-	// note column id
-	const ULONG colid = pred_stats->GetColId();
-	(void) filter_colids->ExchangeSet(colid);
-	*target_last_colid = colid;
+	const ULONG num_points = points->Size();
+	for (ULONG ul = 0; ul < num_points; ++ul)
+	{
+		IDatum *datum = (*points)[ul]->GetDatum();
+		if (!datum->IsNull() && !FSameNativeKey(datum, &enk))
+		{
+			return false;
+		}
+	}
 
-	// clean up
-	GPOS_DELETE(dummy_histogram);
-	deduped_points->Release();
+	LINT *keys = GPOS_NEW_ARRAY(mp, LINT, std::max(num_points, (ULONG) 1));
+	ULONG num_keys = 0;
+	for (ULONG ul = 0; ul < num_points; ++ul)
+	{
+		IDatum *datum = (*points)[ul]->GetDatum();
+		if (!datum->IsNull())
+		{
+			keys[num_keys++] = CRange::LNativeKey(datum);
+		}
+	}
 
-	return result_histogram;
+	// sort and de-duplicate the keys in place
+	clib::Qsort(keys, num_keys, sizeof(LINT), CUtils::ILintCmp);
+	ULONG num_deduped = 0;
+	for (ULONG ul = 0; ul < num_keys; ++ul)
+	{
+		if (0 == num_deduped || keys[num_deduped - 1] != keys[ul])
+		{
+			keys[num_deduped++] = keys[ul];
+		}
+	}
+	*num_distinct = num_deduped;
+	CDouble dummy_rows(num_deduped);
+
+	ULONG key_iter = 0;
+	for (ULONG ul = 0; ul < num_buckets; ++ul)
+	{
+		CBucket *bucket = (*buckets)[ul];
+		const LINT lower =
+			CRange::LNativeKey(bucket->GetLowerBound()->GetDatum());
+		const LINT upper =
+			CRange::LNativeKey(bucket->GetUpperBound()->GetDatum());
+
+		// keys before the bucket are added to ndv_remain
+		ULONG first = FirstKeyAfterBound(keys, key_iter, num_deduped, lower,
+										 bucket->IsLowerClosed());
+		*ndv_remain += first - key_iter;
+
+		// keys up to the upper bound map to the current bucket
+		key_iter = FirstKeyAfterBound(keys, first, num_deduped, upper,
+									  !bucket->IsUpperClosed());
+		ULONG ndv = key_iter - first;
+
+		// buckets without points keep a zero frequency, which also covers
+		// arrays of nulls only, where there are no points at all
+		bucket->SetFrequency(0 == ndv ? CDouble(0.0)
+									  : CDouble(ndv) / dummy_rows);
+		bucket->SetDistinct(CDouble(ndv));
+	}
+
+	// keys after the last bucket are added to ndv_remain
+	*ndv_remain += num_deduped - key_iter;
+
+	GPOS_DELETE_ARRAY(keys);
+
+	return true;
 }
 
 // check if the column is a new column for statistic calculation
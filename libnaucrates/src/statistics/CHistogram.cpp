@@ -895,6 +895,8 @@ CHistogram::MakeLASJHistogram(CStatsPred::EStatsCmpType stats_cmp_type,
 
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
+		GPOS_CHECK_ABORT;
+
 		// bucket from other histogram
 		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
 
@@ -1091,6 +1093,8 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 	CBucketArray *join_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
+		GPOS_CHECK_ABORT;
+
 		CBucket *bucket1 = (*m_histogram_buckets)[idx1];
 		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
 
@@ -145,6 +145,7 @@ CJoinStatsProcessor::CalcAllJoinStats(CMemoryPool *mp,
 			break;
 
 		case COperator::EopLogicalLeftOuterJoin:
+		case COperator::EopLogicalRightOuterJoin:
 			left_outer_2_way_join = true;
 			break;
 
@@ -534,6 +535,19 @@ CJoinStatsProcessor::DeriveJoinStats(CMemoryPool *mp,
 		statistics_array->Append(child_stats);
 	}
 
+	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
+	GPOS_ASSERT(COperator::EopLogicalLeftOuterJoin == op_id ||
+				COperator::EopLogicalRightOuterJoin == op_id ||
+				COperator::EopLogicalInnerJoin == op_id ||
+				COperator::EopLogicalNAryJoin == op_id);
+
+	if (COperator::EopLogicalRightOuterJoin == op_id)
+	{
+		// a right outer join is estimated as the left outer join of its
+		// preserved inner child and its null-extended outer child
+		statistics_array->Swap(0, 1);
+	}
+
 	CExpression *join_pred_expr = exprhdl.PexprScalarRepChild(arity - 1);
 
 	join_pred_expr = CPredicateUtils::PexprRemoveImpliedConjuncts(
@@ -550,13 +564,6 @@ CJoinStatsProcessor::DeriveJoinStats(CMemoryPool *mp,
 									   &local_expr, &expr_with_outer_refs);
 	join_pred_expr->Release();
 
-#ifdef GPOS_DEBUG
-	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
-	GPOS_ASSERT(COperator::EopLogicalLeftOuterJoin == op_id ||
-				COperator::EopLogicalInnerJoin == op_id ||
-				COperator::EopLogicalNAryJoin == op_id);
-#endif
-
 	// derive stats based on local join condition
 	IStatistics *join_stats = CJoinStatsProcessor::CalcAllJoinStats(
 		mp, statistics_array, local_expr, exprhdl.Pop());
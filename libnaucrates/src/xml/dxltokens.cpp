@@ -85,6 +85,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("EnforceConstraintsOnDML")},
 		{EdxltokenPushGroupByBelowSetopThreshold,
 		 GPOS_WSZ_LIT("PushGroupByBelowSetopThreshold")},
+		{EdxltokenMemoryBudget, GPOS_WSZ_LIT("MemoryBudget")},
+		{EdxltokenOptimizationDeadline, GPOS_WSZ_LIT("OptimizationDeadline")},
 		{EdxltokenWindowOids, GPOS_WSZ_LIT("WindowOids")},
 		{EdxltokenOidRowNumber, GPOS_WSZ_LIT("RowNumber")},
 		{EdxltokenOidRank, GPOS_WSZ_LIT("Rank")},
@@ -294,6 +296,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("LeftAntiSemiJoinNotIn")},
 
 		{EdxltokenMergeJoinUniqueOuter, GPOS_WSZ_LIT("UniqueOuter")},
+		{EdxltokenRuntimeFilterId, GPOS_WSZ_LIT("RuntimeFilterId")},
+		{EdxltokenRuntimeFilterIds, GPOS_WSZ_LIT("RuntimeFilterIds")},
 
 		{EdxltokenWindowLeadingBoundary, GPOS_WSZ_LIT("LeadingBoundary")},
 		{EdxltokenWindowTrailingBoundary, GPOS_WSZ_LIT("TrailingBoundary")},
@@ -570,6 +574,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 
 		{EdxltokenCheckConstraints, GPOS_WSZ_LIT("CheckConstraints")},
 		{EdxltokenCheckConstraint, GPOS_WSZ_LIT("CheckConstraint")},
+		{EdxltokenForeignKey, GPOS_WSZ_LIT("ForeignKey")},
+		{EdxltokenForeignKeyRefCols, GPOS_WSZ_LIT("ReferencedColumns")},
 
 		{EdxltokenPartConstraint, GPOS_WSZ_LIT("PartConstraint")},
 		{EdxltokenDefaultPartition, GPOS_WSZ_LIT("DefaultPartition")},
@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		main.cpp
+//
+//	@doc:
+//		Minidump replay benchmark; replays the given minidumps, writes
+//		per-phase timings and peak memory in CSV format, and optionally
+//		checks them against a baseline report
+//
+//		gporca_bench [-n iterations] [-o report.csv]
+//					 [-b baseline.csv [-t tolerance%]] minidump...
+//---------------------------------------------------------------------------
+
+#include "gpos/_api.h"
+#include "gpos/types.h"
+#include "gpos/common/CMainArgs.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "naucrates/init.h"
+
+#include "gpopt/init.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/minidump/CMinidumpBenchmark.h"
+
+using namespace gpos;
+using namespace gpopt;
+
+// default number of times each minidump is replayed
+#define GPOPT_BENCHMARK_ITERATIONS 5
+
+// default tolerance, in percent, when checking against a baseline
+#define GPOPT_BENCHMARK_TOLERANCE 10
+
+// command line passed to the benchmark task
+struct SBenchmarkArgs
+{
+	// number of arguments
+	INT m_argc;
+
+	// arguments
+	const CHAR **m_argv;
+};
+
+// number of regressions found against the baseline, or 1 if the benchmark
+// did not complete
+static ULONG regressions = 1;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PvExec
+//
+//	@doc:
+//		Function driving execution
+//
+//---------------------------------------------------------------------------
+static void *
+PvExec(void *pv)
+{
+	SBenchmarkArgs *pargs = (SBenchmarkArgs *) pv;
+	CMainArgs ma(pargs->m_argc, pargs->m_argv, "n:o:b:t:");
+
+	ULONG ulIterations = GPOPT_BENCHMARK_ITERATIONS;
+	ULONG ulTolerance = GPOPT_BENCHMARK_TOLERANCE;
+	const CHAR *szReportFileName = NULL;
+	const CHAR *szBaselineFileName = NULL;
+
+	CHAR ch = '\0';
+	while (ma.Getopt(&ch))
+	{
+		switch (ch)
+		{
+			case 'n':
+				ulIterations = (ULONG) clib::Strtol(optarg, NULL, 10 /*base*/);
+				break;
+
+			case 'o':
+				szReportFileName = optarg;
+				break;
+
+			case 'b':
+				szBaselineFileName = optarg;
+				break;
+
+			case 't':
+				ulTolerance = (ULONG) clib::Strtol(optarg, NULL, 10 /*base*/);
+				break;
+
+			default:
+				// ignore other parameters
+				break;
+		}
+	}
+
+	if (0 == ulIterations || optind >= pargs->m_argc)
+	{
+		GPOS_TRACE(GPOS_WSZ_LIT(
+			"Usage: gporca_bench [-n iterations] [-o report.csv] "
+			"[-b baseline.csv [-t tolerance%]] minidump..."));
+		return NULL;
+	}
+
+	// initialize DXL support
+	InitDXL();
+
+	CMDCache::Init();
+
+	{
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		CMinidumpBenchmark bench(mp, ulIterations);
+		for (INT i = optind; i < pargs->m_argc; i++)
+		{
+			bench.Run(pargs->m_argv[i]);
+		}
+
+		if (NULL != szReportFileName)
+		{
+			bench.WriteReport(szReportFileName);
+		}
+		else
+		{
+			CAutoTrace at(mp);
+			at.Os() << std::endl << bench.PstrReport()->GetBuffer();
+		}
+
+		regressions = 0;
+		if (NULL != szBaselineFileName)
+		{
+			regressions = bench.UlRegressions(szBaselineFileName, ulTolerance);
+
+			CAutoTrace at(mp);
+			at.Os() << "[BENCH]: " << regressions << " regression(s) against "
+					<< szBaselineFileName << " with " << ulTolerance
+					<< "% tolerance";
+		}
+	}
+
+	CMDCache::Shutdown();
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		main
+//
+//	@doc:
+//		Entry point for the minidump benchmark
+//
+//---------------------------------------------------------------------------
+INT
+main(INT iArgs, const CHAR **rgszArgs)
+{
+	// Use default allocator
+	struct gpos_init_params gpos_params = {NULL};
+
+	gpos_init(&gpos_params);
+	gpdxl_init();
+	gpopt_init();
+
+	SBenchmarkArgs args = {iArgs, rgszArgs};
+
+	gpos_exec_params params;
+	params.func = PvExec;
+	params.arg = &args;
+	params.stack_start = &params;
+	params.error_buffer = NULL;
+	params.error_buffer_size = -1;
+	params.abort_requested = NULL;
+
+	if (gpos_exec(&params) || (0 != regressions))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+
+// EOF
@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc.
+//
+//	@filename:
+//		main.cpp
+//
+//	@doc:
+//		Offline calibration of the GPDB cost model; fits the cost model
+//		parameters to executed plans and writes them as a DXL document
+//
+//		gporca_calibrate [-m min_samples] [-o params.xml]
+//						 plan.xml timing.csv [plan.xml timing.csv ...]
+//---------------------------------------------------------------------------
+
+#include "gpos/_api.h"
+#include "gpos/types.h"
+#include "gpos/common/CMainArgs.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/io/CFileWriter.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/string/CStringDynamic.h"
+
+#include "naucrates/init.h"
+
+#include "gpopt/init.h"
+#include "gpdbcost/CCostModelCalibrator.h"
+
+using namespace gpos;
+using namespace gpopt;
+
+// command line passed to the calibration task
+struct SCalibrationArgs
+{
+	// number of arguments
+	INT m_argc;
+
+	// arguments
+	const CHAR **m_argv;
+};
+
+// number of plans that could not be added, or 1 if the calibration did
+// not complete
+static ULONG failures = 1;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PvExec
+//
+//	@doc:
+//		Function driving execution
+//
+//---------------------------------------------------------------------------
+static void *
+PvExec(void *pv)
+{
+	SCalibrationArgs *pargs = (SCalibrationArgs *) pv;
+	CMainArgs ma(pargs->m_argc, pargs->m_argv, "m:o:");
+
+	ULONG ulMinSamples = GPDBCOST_CALIBRATION_MIN_SAMPLES;
+	const CHAR *szParamsFileName = NULL;
+
+	CHAR ch = '\0';
+	while (ma.Getopt(&ch))
+	{
+		switch (ch)
+		{
+			case 'm':
+				ulMinSamples = (ULONG) clib::Strtol(optarg, NULL, 10 /*base*/);
+				break;
+
+			case 'o':
+				szParamsFileName = optarg;
+				break;
+
+			default:
+				// ignore other parameters
+				break;
+		}
+	}
+
+	if (0 == ulMinSamples || optind >= pargs->m_argc ||
+		0 != (pargs->m_argc - optind) % 2)
+	{
+		GPOS_TRACE(GPOS_WSZ_LIT(
+			"Usage: gporca_calibrate [-m min_samples] [-o params.xml] "
+			"plan.xml timing.csv [plan.xml timing.csv ...]"));
+		return NULL;
+	}
+
+	// initialize DXL support
+	InitDXL();
+
+	{
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		CCostModelCalibrator calibrator(mp, ulMinSamples);
+		ULONG ulFailures = 0;
+		for (INT i = optind; i < pargs->m_argc; i += 2)
+		{
+			if (!calibrator.FAddPlan(pargs->m_argv[i], pargs->m_argv[i + 1]))
+			{
+				CAutoTrace at(mp);
+				at.Os() << "[CALIBRATE]: " << pargs->m_argv[i + 1]
+						<< " does not match the nodes of "
+						<< pargs->m_argv[i];
+				ulFailures++;
+			}
+		}
+
+		{
+			CAutoTrace at(mp);
+			for (ULONG ul = 0; ul < CCostModelCalibrator::EcgSentinel; ul++)
+			{
+				CCostModelCalibrator::ECalibrationGroup ecg =
+					(CCostModelCalibrator::ECalibrationGroup) ul;
+				at.Os() << "[CALIBRATE]: " << CCostModelCalibrator::SzGroup(ecg)
+						<< ": " << calibrator.UlSamples(ecg)
+						<< " node(s), multiplier "
+						<< calibrator.DMultiplier(ecg) << std::endl;
+			}
+		}
+
+		CCostModelParamsGPDB *pcp = GPOS_NEW(mp) CCostModelParamsGPDB(mp);
+		calibrator.Calibrate(pcp);
+
+		CStringDynamic str(mp);
+		CCostModelCalibrator::SerializeParams(mp, pcp, &str);
+		pcp->Release();
+
+		if (NULL != szParamsFileName)
+		{
+			CFileWriter fw;
+			fw.Open(szParamsFileName, S_IRUSR | S_IWUSR);
+			fw.Write((const BYTE *) str.GetBuffer(), str.Length());
+			fw.Close();
+		}
+		else
+		{
+			CAutoTrace at(mp);
+			at.Os() << std::endl << str.GetBuffer();
+		}
+
+		failures = ulFailures;
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		main
+//
+//	@doc:
+//		Entry point for the cost model calibration
+//
+//---------------------------------------------------------------------------
+INT
+main(INT iArgs, const CHAR **rgszArgs)
+{
+	// Use default allocator
+	struct gpos_init_params gpos_params = {NULL};
+
+	gpos_init(&gpos_params);
+	gpdxl_init();
+	gpopt_init();
+
+	SCalibrationArgs args = {iArgs, rgszArgs};
+
+	gpos_exec_params params;
+	params.func = PvExec;
+	params.arg = &args;
+	params.stack_start = &params;
+	params.error_buffer = NULL;
+	params.error_buffer_size = -1;
+	params.abort_requested = NULL;
+
+	if (gpos_exec(&params) || (0 != failures))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+
+// EOF
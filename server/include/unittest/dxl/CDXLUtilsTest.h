@@ -35,6 +35,7 @@ public:
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_SerializeQuery();
 	static GPOS_RESULT EresUnittest_SerializePlan();
+	static GPOS_RESULT EresUnittest_SerializePlanUTF8();
 	static GPOS_RESULT EresUnittest_Encoding();
 
 };	// class CDXLUtilsTest
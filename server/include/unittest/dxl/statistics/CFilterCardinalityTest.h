@@ -125,6 +125,14 @@ private:
 
 	static CStatsPred *PstatspredArrayCmpAnyDuplicate(CMemoryPool *mp);
 
+	// create an int4, date or numeric point of the given value
+	static CPoint *PpointOfType(CMemoryPool *mp, OID oid, INT i, BOOL is_null);
+
+	// number of rows after applying a 'col IN (...)' filter to a histogram
+	// like CCardinalityTestUtils::PhistExampleInt4, of the given type
+	static CDouble DRowsArrayCmpAny(CMemoryPool *mp, OID oid, const INT *rgi,
+									ULONG ulVals, BOOL fNull);
+
 
 	// conjunctive predicates
 	static CStatsPred *PstatspredConj(CMemoryPool *mp);
@@ -163,6 +171,9 @@ public:
 	// testing ArryCmpAny predicates
 	static GPOS_RESULT EresUnittest_CStatisticsFilterArrayCmpAny();
 
+	// testing ArryCmpAny predicates whose points have native keys
+	static GPOS_RESULT EresUnittest_CStatisticsFilterArrayCmpAnyNative();
+
 	// testing nested AND / OR predicates
 	static GPOS_RESULT EresUnittest_CStatisticsNestedPred();
 
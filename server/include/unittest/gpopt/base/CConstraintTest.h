@@ -106,10 +106,15 @@ private:
 	static CConstraintDisjunction *Pcstdisjunction(CMemoryPool *mp, IMDId *mdid,
 												   CColRef *colref);
 
+	// build an array of int4 or date constants followed by a null
+	static CExpression *PexprArrayOfConsts(CMemoryPool *mp, OID oid,
+										   const INT *rgi, ULONG ulVals);
+
 public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_CInterval();
+	static GPOS_RESULT EresUnittest_CIntervalNativePoints();
 	static GPOS_RESULT EresUnittest_CIntervalFromScalarExpr();
 	static GPOS_RESULT EresUnittest_CConjunction();
 	static GPOS_RESULT EresUnittest_CDisjunction();
@@ -118,6 +123,7 @@ public:
 	static GPOS_RESULT EresUnittest_CConstraintIntervalConvertsTo();
 	static GPOS_RESULT EresUnittest_CConstraintIntervalPexpr();
 	static GPOS_RESULT EresUnittest_CConstraintIntervalFromArrayExpr();
+	static GPOS_RESULT EresUnittest_CDatumSortedSetNative();
 
 #ifdef GPOS_DEBUG
 	// tests for unconstrainable types
@@ -127,6 +133,9 @@ public:
 	// test constraints on date intervals
 	static GPOS_RESULT EresUnittest_ConstraintsOnDates();
 
+	// test constraints on timestamp intervals
+	static GPOS_RESULT EresUnittest_ConstraintsOnTimestamps();
+
 	// print equivalence classes
 	static void PrintEquivClasses(CMemoryPool *mp, CColRefSetArray *pdrgpcrs,
 								  BOOL fExpected = false);
@@ -41,6 +41,9 @@ private:
 									  CRange *prange2, CRange *prange3,
 									  CRange *prange4, CRange *prange5);
 
+	static GPOS_RESULT EresCheckTimeRanges(const CMDIdGPDB *pmdidType,
+										   PfPdatum pf, CRange::ENativeKey enk);
+
 	static void PrintRange(CMemoryPool *mp, CColRef *colref, CRange *prange);
 
 	// int2 datum
@@ -52,12 +55,20 @@ private:
 	// int8 datum
 	static IDatum *CreateInt8Datum(CMemoryPool *mp, INT li);
 
+	// date datum
+	static IDatum *CreateDateDatum(CMemoryPool *mp, INT i);
+
+	// timestamp datum
+	static IDatum *CreateTimestampDatum(CMemoryPool *mp, INT i);
+
 public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_CRangeInt2();
 	static GPOS_RESULT EresUnittest_CRangeInt4();
 	static GPOS_RESULT EresUnittest_CRangeInt8();
+	static GPOS_RESULT EresUnittest_CRangeDate();
+	static GPOS_RESULT EresUnittest_CRangeTimestamp();
 	static GPOS_RESULT EresUnittest_CRangeFromScalar();
 
 };	// class CRangeTest
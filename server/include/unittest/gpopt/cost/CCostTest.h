@@ -41,6 +41,7 @@ public:
 	static GPOS_RESULT EresUnittest_Parsing();
 	static GPOS_RESULT EresUnittest_ParsingWithException();
 	static GPOS_RESULT EresUnittest_SetParams();
+	static GPOS_RESULT EresUnittest_Calibration();
 
 };	// class CCostTest
 }  // namespace gpopt
@@ -32,11 +32,15 @@ namespace gpopt
 class CEngineTest
 {
 private:
-#ifdef GPOS_DEBUG
-
 	// type definition for of expression generator
 	typedef CExpression *(*Pfpexpr)(CMemoryPool *);
 
+	// helper for optimizing under an exceeded memory budget
+	static GPOS_RESULT EresOptimizeWithMemoryBudget(CMemoryPool *mp,
+													Pfpexpr pfpexpr);
+
+#ifdef GPOS_DEBUG
+
 	// helper for testing engine using an array of expression generators
 	static GPOS_RESULT EresTestEngine(Pfpexpr rgpf[], ULONG size);
 
@@ -58,6 +62,21 @@ public:
 	// basic unittest
 	static GPOS_RESULT EresUnittest_Basic();
 
+	// optimization under an exceeded memory budget
+	static GPOS_RESULT EresUnittest_MemoryBudget();
+
+	// optimization under an exceeded memory budget with an untracked pool
+	static GPOS_RESULT EresUnittest_MemoryBudgetUntrackedPool();
+
+	// optimization after the deadline passed
+	static GPOS_RESULT EresUnittest_Deadline();
+
+	// recording and using xform statistics
+	static GPOS_RESULT EresUnittest_XformStats();
+
+	// compacting the memo between search stages
+	static GPOS_RESULT EresUnittest_MemoCompaction();
+
 	// helper function for optimizing deep join trees
 	static GPOS_RESULT EresOptimize(
 		FnOptimize *pfopt,	 // optimization function
@@ -44,6 +44,9 @@ private:
 	// lookup MD objects through that accessor
 	static void *PvInitMDAAndLookup(void *pv);
 
+	// check if the MD cache has an entry for the given object
+	static BOOL FCachedInMDCache(IMDId *mdid);
+
 	// cache task function pointer
 	typedef void *(*TaskFuncPtr)(void *);
 
@@ -75,6 +78,7 @@ public:
 	static GPOS_RESULT EresUnittest_IndexPartConstraint();
 	static GPOS_RESULT EresUnittest_Cast();
 	static GPOS_RESULT EresUnittest_ScCmp();
+	static GPOS_RESULT EresUnittest_PreloadBuiltin();
 	static GPOS_RESULT EresUnittest_PrematureMDIdRelease();
 
 };	// class CMDAccessorTest